@@ -48,11 +48,33 @@
 #include <avr/interrupt.h>
 #include "TWI_Master.h"
 
-static unsigned char TWI_buf[ TWI_BUFFER_SIZE ];    // Transceiver buffer
+#define TWI_QUEUE_MASK  (TWI_QUEUE_LEN - 1)
+#define TWI_SDA_BIT     PC4
+#define TWI_SCL_BIT     PC5
+
+struct TWI_msg                                      // A queued message. The caller owns the bytes.
+{
+  unsigned char *buf;                               // Address byte, then the data.
+  unsigned char size;                               // Including the address byte.
+  volatile unsigned char *status;                   // TWI_MSG_BUSY until the message is done with.
+  unsigned char *readBuf;                           // Optional read after a repeated START: SLA+R,
+  unsigned char readSize;                           // then room for the data. Size includes SLA+R.
+  volatile unsigned char *readStatus;
+};
+
+static struct TWI_msg TWI_queue[ TWI_QUEUE_LEN ];   // Messages waiting, oldest at TWI_tail.
+static volatile unsigned char TWI_head = 0;         // Count of messages queued. Only the main program moves it.
+static volatile unsigned char TWI_tail = 0;         // Count of messages finished. Only the ISR moves it, or
+                                                    // TWI_Service() with interrupts off.
+static unsigned char *TWI_buf;                      // Transceiver buffer, the caller's message on the wire.
 static unsigned char TWI_msgSize;                   // Number of bytes to be transmitted.
+static unsigned char *TWI_readBuf;                  // Read to follow the write, if TWI_readSize isn't 0.
+static unsigned char TWI_readSize;
 static unsigned char TWI_state = TWI_NO_STATE;      // State byte. Default set to TWI_NO_STATE.
+static volatile unsigned char TWI_watchdog = 0;     // TWI_Service() calls since the bus last made progress.
 
 union TWI_statusReg TWI_statusReg = {0};            // TWI_statusReg is defined in TWI_Master.h
+volatile struct TWI_counters TWI_counters = {0};    // TWI_counters is defined in TWI_Master.h
 
 /****************************************************************************
 Call this function to set up the TWI master to its initial standby state.
@@ -69,90 +91,191 @@ void TWI_Master_Initialise(void)
 }    
     
 /****************************************************************************
-Call this function to test if the TWI_ISR is busy transmitting.
+Call this function to test if there are messages still waiting to go out.
 ****************************************************************************/
 unsigned char TWI_Transceiver_Busy( void )
 {
-  return ( TWCR & (1<<TWIE) );                  // IF TWI Interrupt is enabled then the Transceiver is busy
+  return ( TWI_head != TWI_tail );
 }
 
 /****************************************************************************
-Call this function to fetch the state information of the previous operation. The function will hold execution (loop)
-until the TWI_ISR has completed with the previous operation. If there was an error, then the function 
-will return the TWI State code. 
+Call this function to fetch the state information of the last failed operation.
+It returns TWI_NO_STATE until something has gone wrong. It does not wait.
 ****************************************************************************/
 unsigned char TWI_Get_State_Info( void )
 {
-  while ( TWI_Transceiver_Busy() );             // Wait until TWI has completed the transmission.
-  return ( TWI_state );                         // Return error state.
+  return ( TWI_state );
 }
 
 /****************************************************************************
-Call this function to send a prepared message. The first byte must contain the slave address and the
-read/write bit. Consecutive bytes contain the data to be sent, or empty locations for data to be read
-from the slave. Also include how many bytes that should be sent/read including the address byte.
-The function will hold execution (loop) until the TWI_ISR has completed with the previous operation,
-then initialize the next operation and return.
+Points the transceiver at the oldest queued message and requests a START. With
+'stop' set, the STOP ending the previous message goes out first. Call with
+interrupts off, or from the ISR.
 ****************************************************************************/
-void TWI_Start_Transceiver_With_Data( unsigned char *msg, unsigned char msgSize )
+static void TWI_Start_Next( unsigned char stop )
 {
-  unsigned char temp;
+  struct TWI_msg *m = &TWI_queue[ TWI_tail & TWI_QUEUE_MASK ];
+  TWI_buf      = m->buf;
+  TWI_msgSize  = m->size;
+  TWI_readBuf  = m->readBuf;
+  TWI_readSize = m->readSize;
+  TWI_watchdog = 0;
+  TWCR = (1<<TWEN)|                             // TWI Interface enabled.
+         (1<<TWIE)|(1<<TWINT)|                  // Enable TWI Interrupt and clear the flag.
+         (0<<TWEA)|(1<<TWSTA)|(stop<<TWSTO)|    // Initiate a (STOP and) START condition.
+         (0<<TWWC);                             //
+}
 
-  while ( TWI_Transceiver_Busy() );             // Wait until TWI is ready for next transmission.
+/****************************************************************************
+Hands the oldest message's buffers back to their owners, with the outcome, and removes it from the queue.
+****************************************************************************/
+static void TWI_Retire( unsigned char ok )
+{
+  struct TWI_msg *m = &TWI_queue[ TWI_tail & TWI_QUEUE_MASK ];
+  unsigned char status = ok ? TWI_MSG_DONE : TWI_MSG_FAILED;
+  *m->status = status;
+  if ( m->readSize )
+    *m->readStatus = status;
+  TWI_tail++;
+}
 
-  TWI_msgSize = msgSize;                        // Number of data to transmit.
-  TWI_buf[0]  = msg[0];                         // Store slave address with R/W setting.
-  if (!( msg[0] & (TRUE<<TWI_READ_BIT) ))       // If it is a write operation, then also copy data.
+/****************************************************************************
+Retires the message on the wire and sends a STOP, followed by a START when
+more messages are waiting. Called from the ISR.
+****************************************************************************/
+static void TWI_Finish( unsigned char ok )
+{
+  TWI_statusReg.lastTransOK = ok;
+  if ( ok )
+    TWI_counters.sent++;
+  else
   {
-    for ( temp = 1; temp < msgSize; temp++ )
-      TWI_buf[ temp ] = msg[ temp ];
+    TWI_state = TWSR;
+    TWI_counters.errors++;
   }
-  TWI_statusReg.all = 0;      
-  TWI_state         = TWI_NO_STATE ;
-  TWCR = (1<<TWEN)|                             // TWI Interface enabled.
-         (1<<TWIE)|(1<<TWINT)|                  // Enable TWI Interrupt and clear the flag.
-         (0<<TWEA)|(1<<TWSTA)|(0<<TWSTO)|       // Initiate a START condition.
-         (0<<TWWC);                             //
+  TWI_Retire( ok );
+  if ( TWI_head != TWI_tail )
+    TWI_Start_Next( TRUE );
+  else
+    TWCR = (1<<TWEN)|                           // TWI Interface enabled
+           (0<<TWIE)|(1<<TWINT)|                // Disable TWI Interrupt and clear the flag
+           (0<<TWEA)|(0<<TWSTA)|(1<<TWSTO)|     // Initiate a STOP condition.
+           (0<<TWWC);                           //
 }
 
 /****************************************************************************
-Call this function to resend the last message. The driver will reuse the data previously put in the transceiver buffers.
-The function will hold execution (loop) until the TWI_ISR has completed with the previous operation,
-then initialize the next operation and return.
+Call this function to queue a prepared message. The first byte must contain the slave address and the
+read/write bit. Consecutive bytes contain the data to be sent, or room for the data to be read. Also
+include how many bytes that should be sent/read including the address byte. The message is sent straight
+from (or read straight into) 'msg', so the caller must leave it alone while *status is TWI_MSG_BUSY: the
+driver sets that here, and sets TWI_MSG_DONE or TWI_MSG_FAILED once the message has been dealt with.
+The function never waits: if the queue is full the message is dropped and FALSE is returned.
 ****************************************************************************/
-void TWI_Start_Transceiver( void )
+unsigned char TWI_Queue_Message( unsigned char *msg, unsigned char msgSize, volatile unsigned char *status )
 {
-  while ( TWI_Transceiver_Busy() );             // Wait until TWI is ready for next transmission.
-  TWI_statusReg.all = 0;      
-  TWI_state         = TWI_NO_STATE ;
-  TWCR = (1<<TWEN)|                             // TWI Interface enabled.
-         (1<<TWIE)|(1<<TWINT)|                  // Enable TWI Interrupt and clear the flag.
-         (0<<TWEA)|(1<<TWSTA)|(0<<TWSTO)|       // Initiate a START condition.
-         (0<<TWWC);                             //
+  return TWI_Queue_Transaction( msg, msgSize, status, 0, 0, 0 );
+}
+
+/****************************************************************************
+Call this function to queue a write followed by a read from the same slave in one transaction, joined
+by a repeated START instead of a STOP and a new START. 'wmsg' is as for TWI_Queue_Message(). 'rmsg'
+starts with SLA+R and has room for the reply; rmsgSize includes the address byte. Each buffer has its
+own status, and both end up with the same outcome. With rmsgSize 0 this is TWI_Queue_Message().
+****************************************************************************/
+unsigned char TWI_Queue_Transaction( unsigned char *wmsg, unsigned char wmsgSize, volatile unsigned char *wstatus,
+                                     unsigned char *rmsg, unsigned char rmsgSize, volatile unsigned char *rstatus )
+{
+  unsigned char sreg;
+  struct TWI_msg *m;
+
+  if ( (unsigned char)(TWI_head - TWI_tail) == TWI_QUEUE_LEN )
+  {
+    TWI_counters.dropped++;
+    return FALSE;
+  }
+  m = &TWI_queue[ TWI_head & TWI_QUEUE_MASK ];
+  m->buf        = wmsg;
+  m->size       = wmsgSize;
+  m->status     = wstatus;
+  m->readBuf    = rmsg;
+  m->readSize   = rmsgSize;
+  m->readStatus = rstatus;
+  *wstatus      = TWI_MSG_BUSY;
+  if ( rmsgSize )
+    *rstatus    = TWI_MSG_BUSY;
+
+  sreg = SREG;
+  cli();
+  TWI_head++;
+  TWI_counters.queued++;
+  // Start it now if the bus is idle. A STOP still going out is left to TWI_Service().
+  if ( !(TWCR & ((1<<TWIE)|(1<<TWSTO))) && (unsigned char)(TWI_head - TWI_tail) == 1 )
+    TWI_Start_Next( FALSE );
+  SREG = sreg;
+  return TRUE;
 }
 
 /****************************************************************************
-Call this function to read out the requested data from the TWI transceiver buffer. I.e. first call
-TWI_Start_Transceiver to send a request for data to the slave. Then Run this function to collect the
-data when they have arrived. Include a pointer to where to place the data and the number of bytes
-requested (including the address field) in the function call. The function will hold execution (loop)
-until the TWI_ISR has completed with the previous operation, before reading out the data and returning.
-If there was an error in the previous transmission the function will return the TWI error code.
+Frees a bus that a slave is holding, by bit-banging: up to nine SCL pulses to
+let the slave finish whatever byte it thinks it is sending, then a STOP. The
+message that was being attempted is dropped. Called with interrupts off.
 ****************************************************************************/
-unsigned char TWI_Get_Data_From_Transceiver( unsigned char *msg, unsigned char msgSize )
+static void TWI_Recover( void )
 {
   unsigned char i;
 
-  while ( TWI_Transceiver_Busy() );             // Wait until TWI is ready for next transmission.
+  TWCR = 0;                                     // Hand the pins back to the port. PORTC has them low,
+  DDRC &= ~(1<<TWI_SDA_BIT);                    // so DDR alone switches each between pulled low
+  DDRC &= ~(1<<TWI_SCL_BIT);                    // and released to the external pull-ups.
+  __builtin_avr_delay_cycles( TWI_RECOVER_DELAY );
+  for ( i = 0; i < 9 && !(PINC & (1<<TWI_SDA_BIT)); i++ )
+  {
+    DDRC |= (1<<TWI_SCL_BIT);
+    __builtin_avr_delay_cycles( TWI_RECOVER_DELAY );
+    DDRC &= ~(1<<TWI_SCL_BIT);
+    __builtin_avr_delay_cycles( TWI_RECOVER_DELAY );
+  }
+  DDRC |= (1<<TWI_SCL_BIT);                     // STOP: SDA rises while SCL is high
+  DDRC |= (1<<TWI_SDA_BIT);
+  __builtin_avr_delay_cycles( TWI_RECOVER_DELAY );
+  DDRC &= ~(1<<TWI_SCL_BIT);
+  __builtin_avr_delay_cycles( TWI_RECOVER_DELAY );
+  DDRC &= ~(1<<TWI_SDA_BIT);
+  __builtin_avr_delay_cycles( TWI_RECOVER_DELAY );
+
+  TWI_counters.recoveries++;
+  if ( TWI_head != TWI_tail )
+  {
+    TWI_Retire( FALSE );
+    TWI_counters.errors++;
+  }
+  TWI_state = TWI_BUS_ERROR;
+  TWI_statusReg.lastTransOK = FALSE;
+  TWI_watchdog = 0;
+  TWI_Master_Initialise();
+}
 
-  if( TWI_statusReg.lastTransOK )               // Last transmission competed successfully.              
-  {                                             
-    for ( i=0; i<msgSize; i++ )                 // Copy data from Transceiver buffer.
+/****************************************************************************
+Call this function regularly from the main program, e.g. once per key scan. It starts queued messages
+that could not be started when they were queued, and recovers the bus when a message has made no
+progress for TWI_TIMEOUT_TICKS calls, as happens when the slave holds SCL or SDA low.
+****************************************************************************/
+void TWI_Service( void )
+{
+  unsigned char sreg = SREG;
+  cli();
+  if ( TWI_head != TWI_tail )
+  {
+    if ( !(TWCR & ((1<<TWIE)|(1<<TWSTO))) )
+      TWI_Start_Next( FALSE );
+    else if ( ++TWI_watchdog > TWI_TIMEOUT_TICKS )
     {
-      msg[ i ] = TWI_buf[ i ];
+      TWI_Recover();
+      if ( TWI_head != TWI_tail )
+        TWI_Start_Next( FALSE );
     }
   }
-  return( TWI_statusReg.lastTransOK );                                   
+  SREG = sreg;
 }
 
 // ********** Interrupt Handlers ********** //
@@ -164,7 +287,8 @@ application.
 ISR(TWI_vect)
 {
   static unsigned char TWI_bufPtr;
-  
+
+  TWI_watchdog = 0;                                       // The bus is moving.
   switch (TWSR)
   {
     case TWI_START:             // START has been transmitted  
@@ -179,13 +303,18 @@ ISR(TWI_vect)
                (1<<TWIE)|(1<<TWINT)|                      // Enable TWI Interrupt and clear the flag to send byte
                (0<<TWEA)|(0<<TWSTA)|(0<<TWSTO)|           //
                (0<<TWWC);                                 //  
-      }else                    // Send STOP after last byte
+      }else if (TWI_readSize)  // Repeated START, then read into the second buffer
       {
-        TWI_statusReg.lastTransOK = TRUE;                 // Set status bits to completed successfully. 
+        TWI_buf      = TWI_readBuf;
+        TWI_msgSize  = TWI_readSize;
+        TWI_readSize = 0;
         TWCR = (1<<TWEN)|                                 // TWI Interface enabled
-               (0<<TWIE)|(1<<TWINT)|                      // Disable TWI Interrupt and clear the flag
-               (0<<TWEA)|(0<<TWSTA)|(1<<TWSTO)|           // Initiate a STOP condition.
+               (1<<TWIE)|(1<<TWINT)|                      // Enable TWI Interrupt and clear the flag
+               (0<<TWEA)|(1<<TWSTA)|(0<<TWSTO)|           // Initiate a repeated START condition.
                (0<<TWWC);                                 //
+      }else                    // Send STOP after last byte
+      {
+        TWI_Finish( TRUE );
       }
       break;
     case TWI_MRX_DATA_ACK:      // Data byte has been received and ACK transmitted
@@ -207,11 +336,7 @@ ISR(TWI_vect)
       break; 
     case TWI_MRX_DATA_NACK:     // Data byte has been received and NACK transmitted
       TWI_buf[TWI_bufPtr] = TWDR;
-      TWI_statusReg.lastTransOK = TRUE;                 // Set status bits to completed successfully. 
-      TWCR = (1<<TWEN)|                                 // TWI Interface enabled
-             (0<<TWIE)|(1<<TWINT)|                      // Disable TWI Interrupt and clear the flag
-             (0<<TWEA)|(0<<TWSTA)|(1<<TWSTO)|           // Initiate a STOP condition.
-             (0<<TWWC);                                 //
+      TWI_Finish( TRUE );
       break;      
     case TWI_ARB_LOST:          // Arbitration lost
       TWCR = (1<<TWEN)|                                 // TWI Interface enabled
@@ -224,11 +349,7 @@ ISR(TWI_vect)
     case TWI_MTX_DATA_NACK:     // Data byte has been transmitted and NACK received
     case TWI_BUS_ERROR:         // Bus error due to an illegal START or STOP condition
     default:     
-      TWI_state = TWSR;                                 // Store TWSR and automatically sets clears noErrors bit.
-                                                        // Reset TWI Interface
-      TWCR = (1<<TWEN)|                                 // Enable TWI-interface and release TWI pins
-             (0<<TWIE)|(0<<TWINT)|                      // Disable Interrupt
-             (0<<TWEA)|(0<<TWSTA)|(0<<TWSTO)|           // No Signal requests
-             (0<<TWWC);                                 //
+      TWI_Finish( FALSE );                              // Drop the message. The STOP also releases the
+                                                        // bus after a bus error.
   }
 }
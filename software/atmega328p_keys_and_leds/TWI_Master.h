@@ -47,7 +47,9 @@
 /****************************************************************************
   TWI Status/Control register definitions
 ****************************************************************************/
-#define TWI_BUFFER_SIZE 20   // Set this to the largest message size that will be sent including address byte.
+#define TWI_QUEUE_LEN   4    // Messages waiting to go out, including the one on the wire. Power of two.
+#define TWI_TIMEOUT_TICKS 10 // TWI_Service() calls without bus progress before the bus is recovered.
+#define TWI_RECOVER_DELAY 40 // CPU cycles per half SCL period during recovery (5 us at 8 MHz).
 
 #define TWI_TWBR            0x02         // TWI Bit rate Register setting.
                                         // Se Application note for detailed
@@ -69,15 +71,27 @@ union TWI_statusReg                       // Status byte holding flags.
 
 extern union TWI_statusReg TWI_statusReg;
 
+struct TWI_counters                       // Running totals, for telemetry. They wrap.
+{
+    unsigned int queued;                  // Messages accepted by TWI_Queue_Message().
+    unsigned int sent;                    // Messages the slave took in full.
+    unsigned int dropped;                 // Messages refused because the queue was full.
+    unsigned int errors;                  // Messages lost to NACKs, bus errors or timeouts.
+    unsigned int recoveries;              // Times the bus had to be clocked free.
+};
+
+extern volatile struct TWI_counters TWI_counters;
+
 /****************************************************************************
   Function definitions
 ****************************************************************************/
 void TWI_Master_Initialise( void );
 unsigned char TWI_Transceiver_Busy( void );
 unsigned char TWI_Get_State_Info( void );
-void TWI_Start_Transceiver_With_Data( unsigned char * , unsigned char );
-void TWI_Start_Transceiver( void );
-unsigned char TWI_Get_Data_From_Transceiver( unsigned char *, unsigned char );
+unsigned char TWI_Queue_Message( unsigned char * , unsigned char , volatile unsigned char * );
+unsigned char TWI_Queue_Transaction( unsigned char * , unsigned char , volatile unsigned char * ,
+                                     unsigned char * , unsigned char , volatile unsigned char * );
+void TWI_Service( void );
 
 /****************************************************************************
   Bit and byte definitions
@@ -88,6 +102,10 @@ unsigned char TWI_Get_Data_From_Transceiver( unsigned char *, unsigned char );
 #define TRUE          1
 #define FALSE         0
 
+#define TWI_MSG_DONE    0     // Message status: sent, or read in full.
+#define TWI_MSG_BUSY    1     // Queued or on the wire; leave the buffer alone.
+#define TWI_MSG_FAILED  2     // Given up on after a NACK, bus error or recovery.
+
 /****************************************************************************
   TWI State codes
 ****************************************************************************/
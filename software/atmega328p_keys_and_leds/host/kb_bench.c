@@ -0,0 +1,286 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// kb_bench.c
+//
+// Runs the keyboard controller's scan code (kb_core.c) against the matrix
+// simulator and reports:
+//
+//   - port accesses and their AVR cycles per tick, for the scan and for the
+//     LED bit plane interrupts, the kb_idle() passes that fit between
+//     ticks, and host time per kb_tick()
+//   - the spread of velocities decoded from scripted presses of known
+//     flight time, started at several points within a tick
+//   - the detents decoded from scripted encoder turns
+//   - the brightness each LED level actually gets from the BAM timing
+//
+// Usage: kb_bench [-n idle ticks] [-w frames.txt]
+//
+// With -w, every frame sent is also written out with its send time, in the
+// form the Pico simulator (software/pi_pico_w/host, pico_sim -k) plays back.
+//
+///////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "kb_sim.h"
+#include "kb_core.h"
+#include "kb_proto.h"
+#include "TWI_Master.h"
+#include "twi_stub.h"
+#include "bench_clock.h"
+// ----------------------------------------------------------------------------
+static int16_t key_vel[KB_NUM_KEYS];     // last velocity seen, + press, - release
+static int32_t enc_sum[8];
+static uint32_t frames[4];               // by kind
+static uint32_t overruns;
+static FILE *record = NULL;
+// ----------------------------------------------------------------------------
+static void on_write(const uint8_t *f, uint8_t len)
+{
+  if(record)
+  {
+    fprintf(record, "%llu", (unsigned long long)(kb_sim_cycle / 8));
+    for(uint8_t i=0;i<len;i++)
+      fprintf(record, " %02x", f[i]);
+    fputc('\n', record);
+  }
+  frames[f[0] >> 6]++;
+  if((f[0] & KB_FRAME_KIND_MASK) != KB_FRAME_EVENTS)
+    return;
+  for(uint8_t i=KB_HEADER_LEN;i+1<len;i+=2)
+  {
+    uint8_t type = f[i] & KB_EV_TYPE_MASK;
+    uint8_t id = f[i] & KB_EV_ID_MASK;
+    if(type == KB_EV_PRESS)
+      key_vel[id] = f[i + 1];
+    else if(type == KB_EV_RELEASE)
+      key_vel[id] = -f[i + 1];
+    else if(type == KB_EV_ENCODER)
+      enc_sum[id & 7] += (int8_t)f[i + 1];
+  }
+}
+// ----------------------------------------------------------------------------
+// One timer 0 tick, as main() runs it: kb_tick(), then kb_idle() until the
+// next tick is due. The port counts as the scan left them go in 'scanned',
+// before the idle passes and the rest of the tick's interrupts.
+// ----------------------------------------------------------------------------
+static uint64_t tick_ns;
+static uint32_t ticks;
+static uint64_t idle_passes;
+static void tick(kb_sim_counts_t *scanned)
+{
+  uint64_t start = kb_sim_cycle;
+  uint64_t t0 = bench_ns();
+  kb_tick();
+  tick_ns += bench_ns() - t0;
+  ticks++;
+  if(kb_sim_cycle >= start + KB_SIM_TICK_CYCLES)
+  {
+    overruns++;
+    kb_overrun();
+  }
+  if(scanned)
+    *scanned = kb_sim_counts;
+  while(!kb_sim_tick_due())
+  {
+    kb_idle();
+    idle_passes++;
+  }
+  kb_sim_next_tick();
+}
+// ----------------------------------------------------------------------------
+static uint32_t now_us(void)
+{
+  return kb_sim_cycle / 8;
+}
+// ----------------------------------------------------------------------------
+static void run_for(uint32_t us)
+{
+  uint64_t end = kb_sim_cycle + (uint64_t)us * 8;
+  while(kb_sim_cycle < end)
+    tick(NULL);
+}
+// ----------------------------------------------------------------------------
+// Port traffic of a quiet keyboard: every tick scans, refreshes an LED row
+// and takes the bit plane interrupts, and now and then sends a keyframe or
+// telemetry.
+// ----------------------------------------------------------------------------
+static void bench_idle(uint32_t n)
+{
+  uint64_t scan_ops = 0, scan_cyc = 0, scan_max = 0, isr_cyc = 0, idle_cyc = 0, irqs = 0;
+  tick_ns = 0;
+  ticks = 0;
+  idle_passes = 0;
+  for(uint32_t i=0;i<n;i++)
+  {
+    kb_sim_counts_t c0 = kb_sim_counts, c1;
+    tick(&c1);
+    uint64_t cyc = c1.port_cycles - c0.port_cycles;
+    scan_ops += (c1.port_writes - c0.port_writes) + (c1.port_reads - c0.port_reads) +
+                (c1.timer_reads - c0.timer_reads) + (c1.compare_writes - c0.compare_writes);
+    scan_cyc += cyc;
+    if(cyc > scan_max)
+      scan_max = cyc;
+    uint64_t isr = kb_sim_counts.isr_cycles - c1.isr_cycles;
+    isr_cyc += isr;
+    idle_cyc += kb_sim_counts.port_cycles - c1.port_cycles - isr;
+    irqs += kb_sim_counts.bam_irqs - c1.bam_irqs;
+  }
+  printf("idle, %u ticks:\n", n);
+  printf("  kb_tick port accesses   %.1f per tick\n", (double)scan_ops / n);
+  printf("  kb_tick port cycles     %.1f per tick, max %llu (%.1f%% of the %d cycle tick)\n",
+         (double)scan_cyc / n, (unsigned long long)scan_max,
+         100.0 * scan_max / KB_SIM_TICK_CYCLES, KB_SIM_TICK_CYCLES);
+  printf("  BAM interrupts          %.2f per tick, %.1f port cycles per tick\n",
+         (double)irqs / n, (double)isr_cyc / n);
+  printf("  kb_idle passes          %.1f per tick, %.1f port cycles each (one every %.1f us)\n",
+         (double)idle_passes / n, idle_passes ? (double)idle_cyc / idle_passes : 0.0,
+         idle_passes ? (double)idle_cyc / idle_passes / 8 : 0.0);
+  printf("  host time per kb_tick   %.0f ns\n", (double)tick_ns / ticks);
+  printf("  frames: %u keyframes, %u telemetry, %u events; %u overruns\n",
+         frames[KB_FRAME_KEYFRAME >> 6], frames[KB_FRAME_TELEMETRY >> 6],
+         frames[KB_FRAME_EVENTS >> 6], overruns);
+}
+// ----------------------------------------------------------------------------
+// Presses and releases a button with a range of contact flight times, each
+// starting at several points within a tick, and prints the lowest and
+// highest velocities that came out. A spread means the velocity depends on
+// where the scan happened to be, not only on the flight.
+// ----------------------------------------------------------------------------
+#define VEL_OFFSETS     8   // start points per flight, spread over a tick
+static void bench_velocity(uint32_t bounce_us)
+{
+  static const uint32_t flights[] =
+  {
+    300, 1000, 1250, 1500, 1750, 2000, 2250, 2500, 2750, 4000, 8000, 12000, 20000, 30000, 40000, 55000
+  };
+  const uint8_t key = KB_ID_BUTTON(2, 5);
+  const uint32_t tick_us = KB_SIM_TICK_CYCLES / 8;
+  printf("velocity, contact bounce %u us, %u start points per tick:\n", bounce_us, VEL_OFFSETS);
+  printf("  flight us      press    release\n");
+  for(unsigned i=0;i<sizeof(flights)/sizeof(flights[0]);i++)
+  {
+    int16_t lo[2] = {127, 127}, hi[2] = {0, 0};
+    for(uint32_t o=0;o<VEL_OFFSETS;o++)
+    {
+      uint32_t off = o * tick_us / VEL_OFFSETS;
+      kb_sim_press(key, now_us() + 1000 + off, flights[i], bounce_us);
+      key_vel[key] = 0;
+      run_for(flights[i] + 20000);
+      int16_t v[2] = {key_vel[key], 0};
+      kb_sim_release(key, now_us() + 1000 + off, flights[i], bounce_us);
+      run_for(flights[i] + 20000);
+      v[1] = -key_vel[key];
+      for(int k=0;k<2;k++)
+      {
+        if(v[k] < lo[k])
+          lo[k] = v[k];
+        if(v[k] > hi[k])
+          hi[k] = v[k];
+      }
+    }
+    printf("  %9u   %3d..%-3d   %3d..%d\n", flights[i], lo[0], hi[0], lo[1], hi[1]);
+  }
+}
+// ----------------------------------------------------------------------------
+// Turns an encoder slowly, then quickly, and compares the detents that came
+// out with the detents turned; quick ones are multiplied by design.
+// ----------------------------------------------------------------------------
+static void bench_encoder(void)
+{
+  static const struct { int16_t detents; uint32_t quarter_us; } turns[] =
+  {
+    { 12, 15000}, {-12, 15000}, { 12, 5000}, { 12, 2000}, {-12, 2000}, { 12, 1000}
+  };
+  const uint8_t enc = 3;
+  printf("encoder:\n");
+  printf("  detents  ms/detent  reported\n");
+  for(unsigned i=0;i<sizeof(turns)/sizeof(turns[0]);i++)
+  {
+    uint32_t span = abs(turns[i].detents) * 4 * turns[i].quarter_us;
+    enc_sum[enc] = 0;
+    kb_sim_turn(enc, now_us() + 1000, turns[i].detents, turns[i].quarter_us);
+    run_for(span + 100000);
+    printf("  %7d  %9.1f  %8d\n", turns[i].detents, turns[i].quarter_us * 4 / 1000.0, enc_sum[enc]);
+  }
+}
+// ----------------------------------------------------------------------------
+// Gives LEDs 0..15 steady levels 0..15, in LED frames of up to six
+// commands, then measures how long each is lit.
+// ----------------------------------------------------------------------------
+static void bench_leds(void)
+{
+  uint8_t seq = 0;
+  for(uint8_t led=0;led<16;)
+  {
+    uint8_t *f = twi_stub_led_frame;
+    uint8_t n = 0;
+    for(;n<KB_LED_MAX_CMDS && led<16;n++, led++)
+    {
+      uint8_t *cmd = f + 2 + n * KB_LED_CMD_LEN;
+      cmd[0] = led;
+      cmd[1] = KB_LED_STEADY;
+      cmd[2] = led;
+      cmd[3] = 0;
+    }
+    f[0] = ++seq;
+    f[1] = n;
+    run_for(50000);
+  }
+  float levels[KB_NUM_LEDS];
+  kb_sim_led_levels(levels);
+  run_for(600000);
+  kb_sim_led_levels(levels);
+  printf("LED BAM, measured over 600 ms (lit time x 16 x 6 rows / elapsed):\n");
+  printf("  level  measured\n");
+  for(uint8_t led=0;led<16;led++)
+    printf("  %5u  %8.2f\n", led, levels[led]);
+  float stray = 0;
+  for(uint8_t led=16;led<KB_NUM_LEDS;led++)
+    stray += levels[led];
+  printf("  LEDs 16..47, meant to be off: %.3f total\n", stray);
+}
+// ----------------------------------------------------------------------------
+int main(int argc, char **argv)
+{
+  uint32_t idle = 5000;
+  for(int i=1;i<argc;i++)
+  {
+    if(!strcmp(argv[i], "-n") && i+1 < argc)
+      idle = atoi(argv[++i]);
+    else if(!strcmp(argv[i], "-w") && i+1 < argc)
+    {
+      record = fopen(argv[++i], "w");
+      if(!record)
+      {
+        fprintf(stderr, "can't write %s\n", argv[i]);
+        return 1;
+      }
+      fprintf(record, "# kb_bench: us, then the frame bytes\n");
+    } else
+    {
+      fprintf(stderr, "usage: %s [-n idle ticks] [-w frames.txt]\n", argv[0]);
+      return 1;
+    }
+  }
+  kb_sim_reset();
+  twi_stub_on_write = on_write;
+  TWI_Master_Initialise();
+  kb_core_init();
+  regs_clear();
+  regs_reset();
+  kb_sim_next_tick();
+
+  bench_idle(idle);
+  bench_velocity(0);
+  bench_velocity(300);
+  bench_encoder();
+  bench_leds();
+  printf("overruns: %u, LED frames read: %u\n", overruns, twi_stub_reads);
+  if(record)
+    fclose(record);
+  return 0;
+}
+///////////////////////////////////////////////////////////////////////////////
+// EOF
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,396 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// kb_sim.c
+//
+// Switch matrix, shift register and timer model behind kb_port.h. See
+// kb_sim.h.
+//
+// The switch rows are selected by two cascaded 74LS164s: every rising edge
+// of SW_ROW_CLK shifts SW_ROW_DAT into Q0, and the row whose output is zero
+// is driven low. PIND reads the AND of all driven rows.
+//
+// The LED columns are another 74LS164, shifted the same way; column c is
+// lit when Q(7 - c) is zero. The LED rows are a 74LS595 whose latch clock
+// is tied to its shift clock, so its outputs show the shift register as it
+// was one clock earlier. Row r is lit when output r is one.
+//
+///////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include "kb_sim.h"
+#include "kb_proto.h"
+#include "kb_core.h"
+// ----------------------------------------------------------------------------
+// AVR cycles per port access: sbi/cbi, in, a 16-bit timer read, out
+#define CYC_PORT_WRITE  2
+#define CYC_PORT_READ   1
+#define CYC_TIMER_READ  4
+#define CYC_COMPARE     1
+#define CYC_ISR         10  // interrupt entry, register saves and reti
+
+#define BAM_CYCLES_PER_COUNT  256   // timer 0 prescaler
+
+#define MAX_MOVES       16  // scripted moves per button or encoder
+// ----------------------------------------------------------------------------
+kb_sim_counts_t kb_sim_counts;
+uint64_t kb_sim_cycle;
+
+static uint64_t tick_start;     // cycle timer 0 last rolled over
+static uint64_t compare_at;     // cycle compare B fires next, or ~0
+static uint8_t irq_on;
+static uint8_t in_isr;
+
+static uint8_t portb;
+static uint8_t portc;
+static uint16_t sw_rows;        // 74LS164 pair, bit r low selects row r
+static uint8_t led_cols;        // 74LS164, Q0 in bit 0
+static uint8_t led_shift;       // 74LS595 shift register
+static uint8_t led_rows;        // 74LS595 outputs
+
+static uint64_t led_on[KB_NUM_LEDS];  // cycles each LED has been lit
+static uint64_t led_since;            // cycle led_on was last brought up to date
+static uint64_t led_window;           // cycle kb_sim_led_levels() last started over
+
+// A scripted change of a button, encoder click or encoder turn.
+typedef struct
+{
+  uint64_t t;         // start, in cycles
+  uint32_t flight;    // button: cycles between the two contacts; click: hold
+  uint32_t bounce;    // cycles of contact chatter after each contact moves
+  int16_t detents;    // turn: signed detents; button: 1 = press, 0 = release
+  uint32_t quarter;   // turn: cycles per quarter step
+} move_t;
+
+typedef struct
+{
+  move_t m[MAX_MOVES];
+  uint8_t n;
+} moves_t;
+
+static moves_t buttons[KB_NUM_LEDS];
+static moves_t clicks[8];
+static moves_t turns[8];
+// ----------------------------------------------------------------------------
+// Moves are added in time order; once the list is full the oldest, long
+// since overtaken, makes room.
+// ----------------------------------------------------------------------------
+static void add_move(moves_t *list, move_t m)
+{
+  if(list->n == MAX_MOVES)
+  {
+    memmove(list->m, list->m + 1, sizeof(move_t) * (MAX_MOVES - 1));
+    list->n--;
+  }
+  list->m[list->n++] = m;
+}
+// ----------------------------------------------------------------------------
+// The latest move that has started by time t, or NULL.
+// ----------------------------------------------------------------------------
+static const move_t *last_move(const moves_t *list, uint64_t t)
+{
+  const move_t *best = NULL;
+  for(uint8_t i=0;i<list->n;i++)
+    if(list->m[i].t <= t && (!best || list->m[i].t >= best->t))
+      best = &list->m[i];
+  return best;
+}
+// ----------------------------------------------------------------------------
+// A contact that moves to 'to' at cycle 'at', chattering back and forth for
+// 'bounce' cycles. Returns its state at t.
+// ----------------------------------------------------------------------------
+static uint8_t contact(uint8_t from, uint8_t to, uint64_t at, uint32_t bounce, uint64_t t)
+{
+  if(t < at)
+    return from;
+  if(t < at + bounce && ((t - at) / (KB_SIM_BOUNCE_CYCLES)) & 1)
+    return from;
+  return to;
+}
+// ----------------------------------------------------------------------------
+// Contacts of a button at t, 1 = closed.
+// ----------------------------------------------------------------------------
+static void button_contacts(uint8_t k, uint64_t t, uint8_t *no, uint8_t *nc)
+{
+  const move_t *m = last_move(&buttons[k], t);
+  if(!m)
+  {
+    *no = 0;
+    *nc = 1;
+    return;
+  }
+  if(m->detents)  // press: NC opens, then NO closes
+  {
+    *nc = contact(1, 0, m->t, m->bounce, t);
+    *no = contact(0, 1, m->t + m->flight, m->bounce, t);
+  } else          // release: NO opens, then NC closes
+  {
+    *no = contact(1, 0, m->t, m->bounce, t);
+    *nc = contact(0, 1, m->t + m->flight, m->bounce, t);
+  }
+}
+// ----------------------------------------------------------------------------
+// Quadrature lines of an encoder at t, 1 = open. Turning up goes
+// (1,1) (0,1) (0,0) (1,0) (1,1) per detent; turning down the other way.
+// ----------------------------------------------------------------------------
+static void encoder_lines(uint8_t n, uint64_t t, uint8_t *a, uint8_t *b)
+{
+  static const uint8_t gray_a[4] = {1, 0, 0, 1};
+  static const uint8_t gray_b[4] = {1, 1, 0, 0};
+  *a = 1;
+  *b = 1;
+  const move_t *m = last_move(&turns[n], t);
+  if(!m)
+    return;
+  uint32_t quarters = 4 * (m->detents < 0 ? -m->detents : m->detents);
+  uint64_t step = (t - m->t) / m->quarter;
+  if(step >= quarters)
+    return;
+  uint8_t phase = (step + 1) & 3;   // Gray state after this quarter step
+  if(m->detents < 0)
+    phase = (4 - phase) & 3;
+  *a = gray_a[phase];
+  *b = gray_b[phase];
+}
+// ----------------------------------------------------------------------------
+// What a switch row reads at t, bit clear = closed.
+// ----------------------------------------------------------------------------
+static uint8_t matrix_row(uint8_t row, uint64_t t)
+{
+  uint8_t v = 0xFF;
+  for(uint8_t c=0;c<8;c++)
+  {
+    uint8_t closed = 0;
+    if(row == KB_ROW_ENC_A || row == KB_ROW_ENC_B)
+    {
+      uint8_t a, b;
+      encoder_lines(c, t, &a, &b);
+      closed = !(row == KB_ROW_ENC_A ? a : b);
+    } else if(row == KB_ROW_ENC_CLICK)
+    {
+      const move_t *m = last_move(&clicks[c], t);
+      closed = m && t < m->t + m->flight;
+    } else
+    {
+      uint8_t r = (row - 3) / 2;
+      uint8_t no, nc;
+      button_contacts(KB_ID_BUTTON(r, c), t, &no, &nc);
+      closed = (row == KB_ROW_BTN_NO(r)) ? no : nc;
+    }
+    if(closed)
+      v &= ~(1 << c);
+  }
+  return v;
+}
+// ----------------------------------------------------------------------------
+// Brings the LED on-times up to date, before the LEDs change.
+// ----------------------------------------------------------------------------
+static void led_integrate(void)
+{
+  uint64_t dt = kb_sim_cycle - led_since;
+  led_since = kb_sim_cycle;
+  if(!dt)
+    return;
+  for(uint8_t r=0;r<KB_LED_ROWS;r++)
+  {
+    if(!(led_rows & (1 << r)))
+      continue;
+    for(uint8_t c=0;c<8;c++)
+      if(!(led_cols & (0x80 >> c)))
+        led_on[r * 8 + c] += dt;
+  }
+}
+// ----------------------------------------------------------------------------
+// Lets time pass, taking the compare B interrupt if it comes due.
+// ----------------------------------------------------------------------------
+static void spend(uint32_t cycles)
+{
+  kb_sim_counts.port_cycles += cycles;
+  if(in_isr)
+    kb_sim_counts.isr_cycles += cycles;
+  kb_sim_cycle += cycles;
+  if(irq_on && !in_isr && kb_sim_cycle >= compare_at)
+  {
+    compare_at = ~0ull;
+    in_isr = 1;
+    kb_sim_counts.bam_irqs++;
+    kb_sim_cycle += CYC_ISR;
+    led_bam_step();
+    in_isr = 0;
+  }
+}
+// ----------------------------------------------------------------------------
+void kb_sim_reset(void)
+{
+  memset(&kb_sim_counts, 0, sizeof(kb_sim_counts));
+  memset(buttons, 0, sizeof(buttons));
+  memset(clicks, 0, sizeof(clicks));
+  memset(turns, 0, sizeof(turns));
+  memset(led_on, 0, sizeof(led_on));
+  kb_sim_cycle = tick_start = led_since = led_window = 0;
+  compare_at = ~0ull;
+  irq_on = 1;
+  in_isr = 0;
+  portb = 0xFF;
+  portc = 0xCF;
+  sw_rows = 0xFFFF;
+  led_cols = 0xFF;
+  led_shift = led_rows = 0;
+}
+// ----------------------------------------------------------------------------
+void kb_sim_next_tick(void)
+{
+  uint64_t end = tick_start + KB_SIM_TICK_CYCLES;
+  if(end <= kb_sim_cycle)
+  {
+    // kb_scan_flag went up while the main loop was busy, in kb_tick() or
+    // a kb_idle() pass; the tick starts late, as soon as it looks. Any
+    // further ticks in the meantime only set the flag again.
+    while(end + KB_SIM_TICK_CYCLES <= kb_sim_cycle)
+      end += KB_SIM_TICK_CYCLES;
+    tick_start = end;
+    return;
+  }
+  while(irq_on && compare_at < end)
+  {
+    if(kb_sim_cycle < compare_at)
+      kb_sim_cycle = compare_at;
+    spend(0);
+  }
+  kb_sim_cycle = tick_start = end;
+}
+// ----------------------------------------------------------------------------
+uint8_t kb_sim_tick_due(void)
+{
+  return kb_sim_cycle >= tick_start + KB_SIM_TICK_CYCLES;
+}
+// ----------------------------------------------------------------------------
+void kb_sim_press(uint8_t button, uint32_t t_us, uint32_t flight_us, uint32_t bounce_us)
+{
+  move_t m = {(uint64_t)t_us * 8, flight_us * 8, bounce_us * 8, 1, 0};
+  add_move(&buttons[button], m);
+}
+// ----------------------------------------------------------------------------
+void kb_sim_release(uint8_t button, uint32_t t_us, uint32_t flight_us, uint32_t bounce_us)
+{
+  move_t m = {(uint64_t)t_us * 8, flight_us * 8, bounce_us * 8, 0, 0};
+  add_move(&buttons[button], m);
+}
+// ----------------------------------------------------------------------------
+void kb_sim_click(uint8_t enc, uint32_t t_us, uint32_t hold_us)
+{
+  move_t m = {(uint64_t)t_us * 8, hold_us * 8, 0, 0, 0};
+  add_move(&clicks[enc], m);
+}
+// ----------------------------------------------------------------------------
+void kb_sim_turn(uint8_t enc, uint32_t t_us, int16_t detents, uint32_t quarter_us)
+{
+  move_t m = {(uint64_t)t_us * 8, 0, 0, detents, quarter_us * 8};
+  add_move(&turns[enc], m);
+}
+// ----------------------------------------------------------------------------
+void kb_sim_led_levels(float *levels)
+{
+  led_integrate();
+  uint64_t span = kb_sim_cycle - led_window;
+  for(uint8_t i=0;i<KB_NUM_LEDS;i++)
+  {
+    // each row is on for one tick in six, and level 15 is lit 15/16 of it
+    levels[i] = span ? (float)led_on[i] * 16 * KB_LED_ROWS / span : 0;
+    led_on[i] = 0;
+  }
+  led_window = kb_sim_cycle;
+}
+// ----------------------------------------------------------------------------
+// PORTB: a rising clock edge shifts its register's data bit in
+// ----------------------------------------------------------------------------
+static void portb_write(uint8_t v)
+{
+  uint8_t rise = v & ~portb;
+  portb = v;
+  if(rise & 0x02)
+    sw_rows = (sw_rows << 1) | (v & 0x01);
+  if(rise & 0x28)
+    led_integrate();
+  if(rise & 0x08)
+  {
+    led_rows = led_shift;
+    led_shift = (led_shift << 1) | ((v >> 2) & 1);
+  }
+  if(rise & 0x20)
+    led_cols = (led_cols << 1) | ((v >> 4) & 1);
+}
+// ----------------------------------------------------------------------------
+void kb_sim_portb_set(uint8_t m)
+{
+  kb_sim_counts.port_writes++;
+  portb_write(portb | m);
+  spend(CYC_PORT_WRITE);
+}
+// ----------------------------------------------------------------------------
+void kb_sim_portb_clr(uint8_t m)
+{
+  kb_sim_counts.port_writes++;
+  portb_write(portb & ~m);
+  spend(CYC_PORT_WRITE);
+}
+// ----------------------------------------------------------------------------
+// PORTC bit 0 low clears all the shift registers
+// ----------------------------------------------------------------------------
+void kb_sim_portc_set(uint8_t m)
+{
+  kb_sim_counts.port_writes++;
+  portc |= m;
+  spend(CYC_PORT_WRITE);
+}
+// ----------------------------------------------------------------------------
+void kb_sim_portc_clr(uint8_t m)
+{
+  kb_sim_counts.port_writes++;
+  portc &= ~m;
+  if(!(portc & 0x01))
+  {
+    led_integrate();
+    sw_rows = 0;
+    led_cols = led_shift = led_rows = 0;
+  }
+  spend(CYC_PORT_WRITE);
+}
+// ----------------------------------------------------------------------------
+uint8_t kb_sim_pind(void)
+{
+  kb_sim_counts.port_reads++;
+  uint8_t v = 0xFF;
+  for(uint8_t row=0;row<KB_MATRIX_ROWS;row++)
+    if(!(sw_rows & (1 << row)))
+      v &= matrix_row(row, kb_sim_cycle);
+  spend(CYC_PORT_READ);
+  return v;
+}
+// ----------------------------------------------------------------------------
+uint16_t kb_sim_timer_us(void)
+{
+  kb_sim_counts.timer_reads++;
+  uint16_t v = kb_sim_cycle / 8;
+  spend(CYC_TIMER_READ);
+  return v;
+}
+// ----------------------------------------------------------------------------
+// Compare B fires when timer 0 next counts up to v: later this tick, or in
+// the next one if the count is already past it.
+// ----------------------------------------------------------------------------
+void kb_sim_bam_compare(uint8_t v)
+{
+  kb_sim_counts.compare_writes++;
+  compare_at = tick_start + (uint64_t)v * BAM_CYCLES_PER_COUNT;
+  if(compare_at <= kb_sim_cycle)
+    compare_at += KB_SIM_TICK_CYCLES;
+  spend(CYC_COMPARE);
+}
+// ----------------------------------------------------------------------------
+void kb_sim_irq(uint8_t on)
+{
+  irq_on = on;
+  spend(1);
+}
+///////////////////////////////////////////////////////////////////////////////
+// EOF
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,73 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// kb_sim.h
+//
+// A model of the keyboard controller's hardware, for running kb_core.c on a
+// PC: the 15x8 switch matrix with its row-select shift registers, the 6x8
+// LED matrix with its row and column shift registers, timer 0's compare B
+// interrupt and timer 1. kb_port.h routes every port access here when
+// KB_HOST is defined.
+//
+// Time is kept in CPU cycles. Port accesses cost what the matching AVR
+// instructions would (sbi/cbi 2, in 1, a 16-bit timer read 4, out 1), and
+// that is all the time that passes inside a tick, so the counts say what
+// the port traffic costs, not the whole scan.
+//
+// Buttons and encoders are scripted: a press or a turn is given a start
+// time, and the contacts follow it, with optional bounce.
+//
+///////////////////////////////////////////////////////////////////////////////
+#ifndef __KB_SIM_H__
+#define __KB_SIM_H__
+
+#include <stdint.h>
+
+#define KB_SIM_CPU_HZ       8000000
+#define KB_SIM_TICK_CYCLES  8192    // timer 0: clk/256, TOP 31
+#define KB_SIM_BOUNCE_CYCLES 400    // contact chatter half-period, 50 us
+
+typedef struct
+{
+  uint64_t port_writes;     // set/clear of PORTB or PORTC bits
+  uint64_t port_reads;      // PIND
+  uint64_t timer_reads;     // TCNT1
+  uint64_t compare_writes;  // OCR0B
+  uint64_t port_cycles;     // AVR cycles spent on all of the above
+  uint64_t bam_irqs;        // timer 0 compare B interrupts taken
+  uint64_t isr_cycles;      // the part of port_cycles spent in them
+} kb_sim_counts_t;
+
+extern kb_sim_counts_t kb_sim_counts;
+extern uint64_t kb_sim_cycle;             // now, in CPU cycles since reset
+
+void kb_sim_reset(void);
+// Runs the timer 0 interrupts due before the next tick, then moves the
+// clock to the start of it; if the tick is already due, it starts now.
+void kb_sim_next_tick(void);
+// Whether the next tick has come, as main()'s kb_scan_flag would say.
+uint8_t kb_sim_tick_due(void);
+
+// scripting, times in microseconds
+void kb_sim_press(uint8_t button, uint32_t t_us, uint32_t flight_us, uint32_t bounce_us);
+void kb_sim_release(uint8_t button, uint32_t t_us, uint32_t flight_us, uint32_t bounce_us);
+void kb_sim_click(uint8_t enc, uint32_t t_us, uint32_t hold_us);
+void kb_sim_turn(uint8_t enc, uint32_t t_us, int16_t detents, uint32_t quarter_us);
+
+// LED brightness as seen by an observer since the last call, in BAM levels
+// (0..15), for all KB_NUM_LEDS LEDs
+void kb_sim_led_levels(float *levels);
+
+// port access, for kb_port.h
+void kb_sim_portb_set(uint8_t m);
+void kb_sim_portb_clr(uint8_t m);
+void kb_sim_portc_set(uint8_t m);
+void kb_sim_portc_clr(uint8_t m);
+uint8_t kb_sim_pind(void);
+uint16_t kb_sim_timer_us(void);
+void kb_sim_bam_compare(uint8_t v);
+void kb_sim_irq(uint8_t on);
+
+#endif
+///////////////////////////////////////////////////////////////////////////////
+// EOF
+///////////////////////////////////////////////////////////////////////////////
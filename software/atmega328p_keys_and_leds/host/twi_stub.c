@@ -0,0 +1,72 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// twi_stub.c
+//
+// TWI_Master.h, implemented for the host. See twi_stub.h.
+//
+///////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include "TWI_Master.h"
+#include "twi_stub.h"
+// ----------------------------------------------------------------------------
+union TWI_statusReg TWI_statusReg = {0};
+volatile struct TWI_counters TWI_counters;
+
+void (*twi_stub_on_write)(const uint8_t *frame, uint8_t len);
+uint8_t twi_stub_led_frame[KB_LED_FRAME_LEN];
+uint32_t twi_stub_reads;
+// ----------------------------------------------------------------------------
+static void transfer(unsigned char *msg, unsigned char size, volatile unsigned char *status)
+{
+  if(msg[0] & (TRUE << TWI_READ_BIT))
+  {
+    uint8_t n = size - 1;
+    if(n > KB_LED_FRAME_LEN)
+      n = KB_LED_FRAME_LEN;
+    memcpy(msg + 1, twi_stub_led_frame, n);
+    twi_stub_reads++;
+  } else if(twi_stub_on_write)
+    twi_stub_on_write(msg + 1, size - 1);
+  TWI_counters.sent++;
+  *status = TWI_MSG_DONE;
+}
+// ----------------------------------------------------------------------------
+void TWI_Master_Initialise( void )
+{
+  memset((void *)&TWI_counters, 0, sizeof(TWI_counters));
+  twi_stub_reads = 0;
+}
+// ----------------------------------------------------------------------------
+unsigned char TWI_Transceiver_Busy( void )
+{
+  return 0;
+}
+// ----------------------------------------------------------------------------
+unsigned char TWI_Get_State_Info( void )
+{
+  return TWI_NO_STATE;
+}
+// ----------------------------------------------------------------------------
+unsigned char TWI_Queue_Message( unsigned char *msg, unsigned char size, volatile unsigned char *status )
+{
+  TWI_counters.queued++;
+  transfer(msg, size, status);
+  return TRUE;
+}
+// ----------------------------------------------------------------------------
+unsigned char TWI_Queue_Transaction( unsigned char *wmsg, unsigned char wsize, volatile unsigned char *wstatus,
+                                     unsigned char *rmsg, unsigned char rsize, volatile unsigned char *rstatus )
+{
+  TWI_counters.queued++;
+  transfer(wmsg, wsize, wstatus);
+  if(rsize)
+    transfer(rmsg, rsize, rstatus);
+  return TRUE;
+}
+// ----------------------------------------------------------------------------
+void TWI_Service( void )
+{
+}
+///////////////////////////////////////////////////////////////////////////////
+// EOF
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,24 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// twi_stub.h
+//
+// A stand-in for TWI_Master.c on the host. Every message completes as soon
+// as it is queued: writes are handed to twi_stub_on_write, and reads are
+// answered from twi_stub_led_frame, as the Pico would.
+//
+///////////////////////////////////////////////////////////////////////////////
+#ifndef __TWI_STUB_H__
+#define __TWI_STUB_H__
+
+#include <stdint.h>
+#include "kb_proto.h"
+
+// the frame, without its SLA+W byte
+extern void (*twi_stub_on_write)(const uint8_t *frame, uint8_t len);
+extern uint8_t twi_stub_led_frame[KB_LED_FRAME_LEN];
+extern uint32_t twi_stub_reads;
+
+#endif
+///////////////////////////////////////////////////////////////////////////////
+// EOF
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,822 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// kb_core.c
+//
+// Scanning, debouncing, velocity, encoders, LED modes and framing for the
+// keyboard controller. How it all works is described at the top of main.c;
+// the hardware is reached through kb_port.h.
+//
+///////////////////////////////////////////////////////////////////////////////
+#include "kb_port.h"
+#include "TWI_Master.h"
+#include "kb_proto.h"
+#include "kb_core.h"
+// ----------------------------------------------------------------------------
+// velocity curve: contact flight time in microseconds (timer 1 ticks)
+#define KB_VEL_FAST_US  1000      // this fast or faster is velocity 127
+#define KB_VEL_SLOW_US  40000     // this slow or slower is the last curve point
+#define KB_VEL_TIMEOUT_MS 60      // stop timing; timer 1 wraps at 65.5 ms
+// encoder acceleration: detent intervals below these count extra
+#define KB_ENC_FAST_MS  15        // x4
+#define KB_ENC_MED_MS   40        // x2
+// ----------------------------------------------------------------------------
+uint8_t sw_states[KB_MATRIX_ROWS];    // latest debounced switch rows
+uint8_t vc0[KB_MATRIX_ROWS];          // vertical debounce counters, bit 0
+uint8_t vc1[KB_MATRIX_ROWS];          // and bit 1
+uint16_t row_time[KB_MATRIX_ROWS];    // timer 1 when each row was last sampled
+uint8_t sw_reported[KB_MATRIX_ROWS];  // switch rows as the Pico knows them
+uint8_t tx_buf[2][1 + KB_TM_FRAME_LEN]; // ping-pong frames: SLA+W, then the frame
+volatile uint8_t tx_status[2];  // TWI_MSG_BUSY while the TWI driver owns the buffer
+uint8_t tx_cur = 0;           // buffer this scan builds into
+uint8_t *tx_frame = tx_buf[0];
+uint8_t need_keyframe = 0;    // a frame was lost; resync with a keyframe
+uint8_t ev_count = 0;     // events in tx_frame so far this scan
+uint8_t ev_overflow = 0;  // more events than fit; send a keyframe instead
+uint16_t scan_ms = 0;     // scan timestamp, one tick per full scan
+uint16_t keyframe_ms = 0; // scans since the last keyframe
+// ----------------------------------------------------------------------------
+// timing telemetry, in timer 1 microseconds
+// ----------------------------------------------------------------------------
+#define TM_SCAN_SHIFT   7   // log2(KB_TM_SCAN_BIN_US)
+#define TM_LED_SHIFT    4   // log2(KB_TM_LED_BIN_US)
+typedef struct
+{
+  uint16_t min;
+  uint16_t max;
+  uint8_t hist[8];          // saturate at 255, which a report period can't reach
+} tm_stat_t;
+tm_stat_t tm_scan;
+tm_stat_t tm_led;
+uint16_t tm_overruns = 0;   // scans still going when the next tick came
+uint16_t telemetry_ms = 0;  // scans since the last telemetry frame
+uint8_t skip_led = 0;       // behind schedule; leave out one LED row refresh
+uint8_t tx_seq = 0;
+// ----------------------------------------------------------------------------
+// per-button velocity state machines
+// ----------------------------------------------------------------------------
+#define KEY_UP          0 // NC closed, NO open
+#define KEY_GOING_DOWN  1 // NC opened, waiting for NO to close
+#define KEY_DOWN        2 // NO closed
+#define KEY_GOING_UP    3 // NO opened, waiting for NC to close
+#define NUM_BUTTONS     48
+uint8_t key_state[NUM_BUTTONS];
+uint16_t key_t0[NUM_BUTTONS];     // timer 1 when the first contact let go
+uint8_t key_flight[NUM_BUTTONS];  // scans since then, for long flights
+uint8_t key_down[6];    // per button row: bit set when the key is down
+uint8_t key_moving[6];  // per button row: bit set while between contacts
+uint8_t prev_no[6];     // last samples of the contacts, bit set = closed
+uint8_t prev_nc[6];
+// When each button contact first read differently from its debounced
+// state, from the scans and from the samples kb_idle() takes between them.
+// A bit of edge_valid is set while its edge_time holds such a time.
+#define BTN_ROW0        KB_ROW_BTN_NO(0)
+uint16_t edge_time[KB_MATRIX_ROWS - BTN_ROW0][8];
+uint8_t edge_valid[KB_MATRIX_ROWS - BTN_ROW0];
+// ----------------------------------------------------------------------------
+// encoder decoding
+// ----------------------------------------------------------------------------
+uint8_t enc_prev_a = 0xFF;  // last raw A and B rows (all open)
+uint8_t enc_prev_b = 0xFF;
+int8_t enc_quarter[8];      // quarter steps since the last detent
+int8_t enc_dir[8];          // direction of the last quarter step
+int8_t enc_delta[8];        // detents not yet sent
+uint16_t enc_last_ms[8];    // scan_ms of the last detent
+// quarter steps for each (old A, old B, new A, new B) transition; the
+// impossible both-changed entries are handled separately
+const int8_t enc_table[16] PROGMEM =
+{
+   0, -1,  1,  0,
+   1,  0,  0, -1,
+  -1,  0,  0,  1,
+   0,  1, -1,  0
+};
+// Velocity at 17 evenly spaced flight times from KB_VEL_FAST_US to
+// KB_VEL_SLOW_US. Reshape this to change how the keys feel.
+const uint8_t vel_curve[17] PROGMEM =
+{
+  127, 104, 86, 71, 59, 49, 41, 34, 28, 23, 19, 15, 12, 9, 6, 3, 1
+};
+// per-LED mode table, set by the Pico's LED frames (see kb_proto.h)
+uint8_t led_mode[KB_NUM_LEDS];    // KB_LED_*, with chase position and length
+uint8_t led_level[KB_NUM_LEDS];   // 0..15
+uint8_t led_rate[KB_NUM_LEDS];    // time step is 2^rate ms
+uint8_t led_planes[KB_LED_ROWS][4]; // per LED row, bit planes 0 (LSB) to 3 of the levels
+volatile uint8_t bam_row = 0;       // LED row being modulated
+volatile uint8_t bam_plane = 0xFF;  // plane on display, 0xFF when done
+uint8_t cur_led_row = 0;  // current led row for refresh
+uint8_t led_rx[1 + KB_LED_FRAME_LEN]; // SLA+R, then the Pico's LED frame
+volatile uint8_t led_rx_status = TWI_MSG_DONE;
+uint8_t led_rx_pending = 0; // a read of led_rx has been queued
+uint8_t led_poll_due = 0;   // read the LEDs with the next frame that goes
+uint8_t led_seq = 0;        // sequence number of the LED frame on show
+uint8_t led_ack_due = 0;    // took in a new LED frame; tell the Pico
+unsigned char TWI_targetSlaveAddress = 0x30;
+// ----------------------------------------------------------------------------
+// Initialize the state of all shift registers.
+// Selects the first row each of both the switch and the LED matrices.
+// ----------------------------------------------------------------------------
+void regs_reset(void)
+{
+  // De-select all switch rows, all led rows, and all LED columns
+  KB_PORTB_SET(0x11);  // LED_COL_DAT = 1, SW_ROW_DAT = 1
+  KB_PORTB_CLR(0x04);  // LED_ROW_DAT = 0
+  for (uint8_t i=0;i<16;i++)
+  {
+    KB_PORTB_CLR(0x2A); // start clock pulses on led row, sw row, and sw col
+    KB_PORTB_SET(0x2A); // end clock pulses
+  }
+  // clock a single 0 into the sw row reg to select the first sw row,
+  // and clock a single 1 into the led row reg to select the first led row
+  KB_PORTB_CLR(0x01); // SW_ROW_DAT = 0
+  KB_PORTB_SET(0x04);  // LED_ROW_DAT = 1
+  KB_PORTB_CLR(0x0A); // LED_ROW_CLK = 0, SW_ROW_CLK = 0
+  KB_PORTB_SET(0x0A);  // LED_ROW_CLK = 1, SW_ROW_CLK = 1
+  KB_PORTB_CLR(0x04); // LED_ROW_DAT = 0
+  KB_PORTB_SET(0x01);  // SW_ROW_DAT = 1
+}
+// ----------------------------------------------------------------------------
+// resets all shift regs to 0's - not really very useful
+// ----------------------------------------------------------------------------
+void regs_clear(void)
+{
+  KB_PORTC_CLR(0x01); // start reset pulse
+  KB_PORTC_SET(0x01); // end reset pulse
+}
+// ----------------------------------------------------------------------------
+// Shifts 8 bits into the LED columns register. Bits which are set will cause
+// the corresponding LED to be lit on the currently selected row.
+// ----------------------------------------------------------------------------
+static inline void set_led_row(uint8_t cols)
+{
+  for(uint8_t i=0;i<8;i++)
+  {
+    KB_PORTB_CLR(0x10);    // LED_COL_DAT = 0
+    if(!(cols&1))
+      KB_PORTB_SET(0x10);   // LED_COL_DAT = NOT cols.LSB
+    // clock the bit value into the cols register
+    KB_PORTB_CLR(0x20);   // LED_COL_CLK = 0
+    KB_PORTB_SET(0x20);    // LED_COL_CLK = 1
+    cols>>=1;         // select next bit of cols value
+  }
+}
+// ----------------------------------------------------------------------------
+// Timer 0 count at which each bit plane's time is up: plane 3 gets the first
+// half of the tick, plane 2 the next quarter, and so on.
+// ----------------------------------------------------------------------------
+static const uint8_t bam_end[4] =
+{
+  (TIMER0_TOP + 1) * 15 / 16,
+  (TIMER0_TOP + 1) * 7 / 8,
+  (TIMER0_TOP + 1) * 3 / 4,
+  (TIMER0_TOP + 1) / 2
+};
+// ----------------------------------------------------------------------------
+// Timer 0 compare B: shows the next lower bit plane of the current row, or
+// blanks the row once plane 0 has had its time.
+// ----------------------------------------------------------------------------
+void led_bam_step(void)
+{
+  uint8_t p = bam_plane;
+  if(p > 3)
+    return;
+  if(p == 0)
+  {
+    set_led_row(0);
+    bam_plane = 0xFF;
+    return;
+  }
+  p--;
+  set_led_row(led_planes[bam_row][p]);
+  KB_BAM_COMPARE(bam_end[p]);
+  bam_plane = p;
+}
+// ----------------------------------------------------------------------------
+// Works out an LED's level at scan time t from its mode.
+// ----------------------------------------------------------------------------
+static inline uint8_t led_level_at(uint8_t led, uint16_t t)
+{
+  uint8_t mode = led_mode[led];
+  uint8_t level = led_level[led];
+  uint16_t step = t >> led_rate[led];
+  switch(mode & KB_LED_MODE_MASK)
+  {
+  case KB_LED_BLINK:
+    return (step & 1) ? 0 : level;
+  case KB_LED_PULSE:
+  {
+    uint8_t ramp = step & 31;   // 0..16..1
+    if(ramp > 16)
+      ramp = 32 - ramp;
+    return (ramp * level) >> 4;
+  }
+  case KB_LED_CHASE:
+    // 8-bit modulo; a chase whose length isn't a power of two skips a
+    // beat every 256 steps
+    return ((uint8_t)step % KB_LED_CHASE_LEN(mode) == KB_LED_CHASE_POS(mode)) ? level : 0;
+  default:
+    return level;
+  }
+}
+// ----------------------------------------------------------------------------
+// Builds the bit planes of an LED row from the mode table.
+// ----------------------------------------------------------------------------
+static inline void eval_led_row(uint8_t row)
+{
+  uint8_t planes[4] = {0, 0, 0, 0};
+  uint8_t led = row * 8;
+  for(uint8_t bit=1;bit;bit<<=1, led++)
+  {
+    uint8_t level = led_level_at(led, scan_ms);
+    for(uint8_t p=0;p<4;p++, level>>=1)
+      if(level & 1)
+        planes[p] |= bit;
+  }
+  for(uint8_t p=0;p<4;p++)
+    led_planes[row][p] = planes[p];
+}
+// ----------------------------------------------------------------------------
+// Starts the next LED row on its most significant bit plane. The compare B
+// interrupt takes it through the rest. The row is selected first, while the
+// columns are still dark from the last row's plane 0, so the new row's
+// columns never shift through the old one.
+// ----------------------------------------------------------------------------
+void refresh_led_row(void)
+{
+  uint8_t row = cur_led_row;
+  eval_led_row(row);
+  uint8_t lit = bam_plane <= 3;
+  bam_plane = 0xFF;   // keep the ISR off the columns while we change them
+  if(lit)             // plane 0 hasn't run yet; blank the old row ourselves
+    set_led_row(0);
+  cur_led_row++;
+  if(cur_led_row == 6) // if finished all LED rows
+  {
+    // reselect first row of leds
+    cur_led_row = 0;
+    KB_PORTB_SET(0x04);  // LED_ROW_DAT = 1
+    KB_PORTB_CLR(0x08); // LED_ROW_CLK = 0
+    KB_PORTB_SET(0x08);  // LED_ROW_CLK = 1
+    // don't select more than one LED row at a time
+    KB_PORTB_CLR(0x04); // LED_ROW_DAT = 0
+  } else  // still have led rows left to update
+  {
+    // select next led row
+    KB_PORTB_CLR(0x08); // LED_ROW_CLK = 0
+    KB_PORTB_SET(0x08);  // LED_ROW_CLK = 1
+  }
+  set_led_row(led_planes[row][3]);
+  bam_row = row;
+  KB_BAM_COMPARE(bam_end[3]);
+  bam_plane = 3;
+}
+// ----------------------------------------------------------------------------
+// Once per LED refresh cycle: applies the mode changes in the last LED frame
+// read from the Pico, if it is new, and asks for another. The read normally
+// rides along with a key frame; see send_frame() and poll_leds().
+// ----------------------------------------------------------------------------
+static inline void take_led_frame(void)
+{
+  if(led_rx_pending && led_rx_status != TWI_MSG_BUSY)
+  {
+    led_rx_pending = 0;
+    if(led_rx_status == TWI_MSG_DONE && led_rx[1] != led_seq)
+    {
+      led_seq = led_rx[1];
+      led_ack_due = 1;
+      uint8_t n = led_rx[2];
+      if(n > KB_LED_MAX_CMDS)
+        n = KB_LED_MAX_CMDS;
+      for(uint8_t *cmd = led_rx + 3;n;n--, cmd += KB_LED_CMD_LEN)
+      {
+        uint8_t led = cmd[0];
+        if(led >= KB_NUM_LEDS)
+          continue;
+        led_mode[led] = cmd[1];
+        led_level[led] = cmd[2];
+        led_rate[led] = cmd[3] & 15;
+      }
+    }
+  }
+  led_poll_due = 1;
+}
+// ----------------------------------------------------------------------------
+// Reads the LED frame on its own, when no key frame went out to carry the
+// read.
+// ----------------------------------------------------------------------------
+static inline void poll_leds(void)
+{
+  if(led_rx_status == TWI_MSG_BUSY)
+    return;
+  if(TWI_Queue_Message( led_rx, sizeof(led_rx), &led_rx_status ))
+  {
+    led_poll_due = 0;
+    led_rx_pending = 1;
+  }
+}
+// ----------------------------------------------------------------------------
+// Fills in the frame header ahead of a payload of 'len' bytes, and hands the
+// buffer to the TWI driver, which sends straight from it. The next scan
+// builds into the other buffer.
+// ----------------------------------------------------------------------------
+static inline void send_frame(uint8_t kind, uint8_t len)
+{
+  tx_frame[0] = TWI_targetSlaveAddress << 1;
+  tx_frame[1] = kind | (tx_seq++ & KB_SEQ_MASK);
+  tx_frame[2] = scan_ms & 0xFF;
+  tx_frame[3] = scan_ms >> 8;
+  tx_frame[4] = led_seq;
+  led_ack_due = 0;
+  // read the LEDs back in the same transaction, if they are due
+  uint8_t rx_len = 0;
+  if(led_poll_due && led_rx_status != TWI_MSG_BUSY)
+    rx_len = sizeof(led_rx);
+  if(!TWI_Queue_Transaction( tx_frame, 1 + KB_HEADER_LEN + len, &tx_status[tx_cur],
+                             led_rx, rx_len, &led_rx_status ))
+  {
+    need_keyframe = 1;
+    return;
+  }
+  if(rx_len)
+  {
+    led_poll_due = 0;
+    led_rx_pending = 1;
+  }
+  tx_cur ^= 1;
+  tx_frame = tx_buf[tx_cur];
+}
+// ----------------------------------------------------------------------------
+// Sends the whole matrix, bringing the Pico fully up to date. The buttons'
+// normally-open rows carry the velocity state machines' idea of which keys
+// are down, so keyframes and events always agree.
+// ----------------------------------------------------------------------------
+static inline void send_keyframe(void)
+{
+  if(tx_status[tx_cur] == TWI_MSG_BUSY)   // both buffers still going out; try next scan
+  {
+    need_keyframe = 1;
+    return;
+  }
+  need_keyframe = 0;
+  uint8_t *p = tx_frame + 1 + KB_HEADER_LEN;
+  for(uint8_t row=0;row<KB_MATRIX_ROWS;row++)
+    p[row] = sw_reported[row] = sw_states[row];
+  for(uint8_t r=0;r<6;r++)
+    p[KB_ROW_BTN_NO(r)] = ~key_down[r];
+  send_frame(KB_FRAME_KEYFRAME, KB_MATRIX_ROWS);
+  keyframe_ms = 0;
+}
+// ----------------------------------------------------------------------------
+// Adds an event to the frame being built for this scan.
+// ----------------------------------------------------------------------------
+static inline uint8_t put_event(uint8_t code, uint8_t value)
+{
+  if(ev_count == KB_MAX_EVENTS)
+  {
+    ev_overflow = 1;
+    return 0;
+  }
+  uint8_t *p = tx_frame + 1 + KB_HEADER_LEN + 2 * ev_count++;
+  p[0] = code;
+  p[1] = value;
+  return 1;
+}
+// ----------------------------------------------------------------------------
+// Converts a contact flight time to a velocity, 1..127.
+// ----------------------------------------------------------------------------
+static uint8_t velocity(uint16_t us, uint8_t flight_ms)
+{
+  if(flight_ms >= KB_VEL_TIMEOUT_MS || us >= KB_VEL_SLOW_US)
+    return pgm_read_byte(&vel_curve[16]);
+  if(us <= KB_VEL_FAST_US)
+    return 127;
+  // position along the curve, 8.4 fixed point
+  uint8_t pos = ((uint32_t)(us - KB_VEL_FAST_US) << 8) / (KB_VEL_SLOW_US - KB_VEL_FAST_US);
+  uint8_t i = pos >> 4;
+  int16_t a = pgm_read_byte(&vel_curve[i]);
+  int16_t b = pgm_read_byte(&vel_curve[i + 1]);
+  return a + (((b - a) * (pos & 15)) >> 4);
+}
+// ----------------------------------------------------------------------------
+// When a button contact moved: its edge time if there is one, or else when
+// its row was sampled.
+// ----------------------------------------------------------------------------
+static inline uint16_t contact_time(uint8_t e, uint8_t col, uint8_t bit)
+{
+  if(edge_valid[e] & bit)
+    return edge_time[e][col];
+  return row_time[e + BTN_ROW0];
+}
+// ----------------------------------------------------------------------------
+// Runs the velocity state machines of the buttons whose contacts changed,
+// or that are between contacts, and queues press and release events.
+// ----------------------------------------------------------------------------
+static inline void track_buttons(void)
+{
+  for(uint8_t r=0;r<6;r++)
+  {
+    uint8_t no = ~sw_states[KB_ROW_BTN_NO(r)];  // bit set = contact closed
+    uint8_t nc = ~sw_states[KB_ROW_BTN_NC(r)];
+    uint8_t no_moved = no ^ prev_no[r];
+    uint8_t nc_moved = nc ^ prev_nc[r];
+    uint8_t look = no_moved | nc_moved | key_moving[r];
+    prev_no[r] = no;
+    prev_nc[r] = nc;
+    if(!look)
+      continue;
+    uint8_t e_no = KB_ROW_BTN_NO(r) - BTN_ROW0;
+    uint8_t e_nc = KB_ROW_BTN_NC(r) - BTN_ROW0;
+    uint8_t k = r * 8;
+    uint8_t c = 0;
+    for(uint8_t bit=1;look;bit<<=1, k++, c++)
+    {
+      if(!(look & bit))
+        continue;
+      look &= ~bit;
+      uint8_t no_closed = no & bit;
+      uint8_t nc_closed = nc & bit;
+      uint16_t t_no = contact_time(e_no, c, bit);
+      uint16_t t_nc = contact_time(e_nc, c, bit);
+      switch(key_state[k])
+      {
+      case KEY_UP:
+        if(no_closed)           // both contacts moved since the last scan
+        {
+          key_state[k] = KEY_DOWN;
+          key_down[r] |= bit;
+          put_event(KB_EV_PRESS | k, velocity(t_no - t_nc, 0));
+        } else if(!nc_closed)   // on its way down
+        {
+          key_state[k] = KEY_GOING_DOWN;
+          key_t0[k] = t_nc;
+          key_flight[k] = 0;
+          key_moving[r] |= bit;
+        }
+        break;
+      case KEY_GOING_DOWN:
+        if(no_closed)
+        {
+          key_state[k] = KEY_DOWN;
+          key_down[r] |= bit;
+          key_moving[r] &= ~bit;
+          put_event(KB_EV_PRESS | k, velocity(t_no - key_t0[k], key_flight[k]));
+        } else if(nc_closed)    // let go before it got there
+        {
+          key_state[k] = KEY_UP;
+          key_moving[r] &= ~bit;
+        } else if(++key_flight[k] >= KB_VEL_TIMEOUT_MS)
+          key_moving[r] &= ~bit;  // half pressed; wait for a contact change
+        break;
+      case KEY_DOWN:
+        if(nc_closed)
+        {
+          key_state[k] = KEY_UP;
+          key_down[r] &= ~bit;
+          put_event(KB_EV_RELEASE | k, velocity(t_nc - t_no, 0));
+        } else if(!no_closed)
+        {
+          key_state[k] = KEY_GOING_UP;
+          key_t0[k] = t_no;
+          key_flight[k] = 0;
+          key_moving[r] |= bit;
+        }
+        break;
+      case KEY_GOING_UP:
+        if(nc_closed)
+        {
+          key_state[k] = KEY_UP;
+          key_down[r] &= ~bit;
+          key_moving[r] &= ~bit;
+          put_event(KB_EV_RELEASE | k, velocity(t_nc - key_t0[k], key_flight[k]));
+        } else if(no_closed)    // pushed back down
+        {
+          key_state[k] = KEY_DOWN;
+          key_moving[r] &= ~bit;
+        } else if(++key_flight[k] >= KB_VEL_TIMEOUT_MS)
+          key_moving[r] &= ~bit;
+        break;
+      }
+    }
+    // the edges of contacts that changed state are used up
+    edge_valid[e_no] &= ~no_moved;
+    edge_valid[e_nc] &= ~nc_moved;
+  }
+}
+// ----------------------------------------------------------------------------
+// Decodes the quadrature rows into enc_delta, the detents each encoder has
+// yet to report.
+// ----------------------------------------------------------------------------
+static inline void track_encoders(void)
+{
+  uint8_t a = sw_states[KB_ROW_ENC_A];
+  uint8_t b = sw_states[KB_ROW_ENC_B];
+  uint8_t moved = (a ^ enc_prev_a) | (b ^ enc_prev_b);
+  if(moved)
+  {
+    uint8_t both = (a ^ enc_prev_a) & (b ^ enc_prev_b);
+    uint8_t n = 0;
+    for(uint8_t bit=1;moved;bit<<=1, n++)
+    {
+      if(!(moved & bit))
+        continue;
+      moved &= ~bit;
+      if(both & bit)
+        enc_quarter[n] += 2 * enc_dir[n];
+      else
+      {
+        uint8_t i = ((enc_prev_a & bit) ? 8 : 0) | ((enc_prev_b & bit) ? 4 : 0) |
+                    ((a & bit) ? 2 : 0) | ((b & bit) ? 1 : 0);
+        int8_t q = pgm_read_byte(&enc_table[i]);
+        enc_quarter[n] += q;
+        enc_dir[n] = q;
+      }
+      if((a & b & bit) && enc_quarter[n])  // back at rest
+      {
+        int8_t d = 0;
+        if(enc_quarter[n] >= 2)
+          d = 1;
+        else if(enc_quarter[n] <= -2)
+          d = -1;
+        enc_quarter[n] = 0;
+        if(d)
+        {
+          uint16_t gap = scan_ms - enc_last_ms[n];
+          enc_last_ms[n] = scan_ms;
+          if(gap < KB_ENC_FAST_MS)
+            d *= 4;
+          else if(gap < KB_ENC_MED_MS)
+            d *= 2;
+          int16_t sum = enc_delta[n] + d;
+          enc_delta[n] = sum > 127 ? 127 : sum < -127 ? -127 : sum;
+        }
+      }
+    }
+    enc_prev_a = a;
+    enc_prev_b = b;
+  }
+}
+// ----------------------------------------------------------------------------
+// Works out what changed in the latest scan, and sends it. Every scan runs
+// buttons through the velocity state machines and encoders through the
+// quadrature decoder, and turns encoder clicks into press/release events,
+// whatever goes out. Then: a keyframe if one is owed or there were too many
+// changes for one frame; else the events, with the encoder deltas that fit
+// (the rest wait for the next frame); else, on a quiet scan, the periodic
+// keyframe once it is due.
+// ----------------------------------------------------------------------------
+static inline void send_changes(void)
+{
+  ev_count = 0;
+  ev_overflow = 0;
+  uint8_t busy = tx_status[tx_cur] == TWI_MSG_BUSY;
+  if(busy)                    // no buffer free: any change becomes a
+    ev_count = KB_MAX_EVENTS; // keyframe, sent once one is
+  track_encoders();
+  uint8_t now = sw_states[KB_ROW_ENC_CLICK];
+  uint8_t changed = now ^ sw_reported[KB_ROW_ENC_CLICK];
+  uint8_t id = KB_ID_ENC_CLICK(0);
+  for(uint8_t bit=1;changed;bit<<=1, id++)
+  {
+    if(!(changed & bit))
+      continue;
+    changed &= ~bit;
+    // switches read zero when closed
+    if(now & bit)
+      put_event(KB_EV_RELEASE | id, 127);
+    else
+      put_event(KB_EV_PRESS | id, 127);
+  }
+  track_buttons();
+
+  if(ev_overflow || need_keyframe)
+  {
+    send_keyframe();
+    return;
+  }
+  for(uint8_t n=0;n<8 && ev_count<KB_MAX_EVENTS;n++)
+  {
+    if(enc_delta[n])
+    {
+      put_event(KB_EV_ENCODER | n, enc_delta[n]);
+      enc_delta[n] = 0;
+    }
+  }
+  if(busy)
+    return;
+  for(uint8_t row=0;row<KB_MATRIX_ROWS;row++)
+    sw_reported[row] = sw_states[row];
+  if(ev_count || led_ack_due)
+    send_frame(KB_FRAME_EVENTS, ev_count * 2);
+  else if(keyframe_ms >= KB_KEYFRAME_MS)
+    send_keyframe();
+}
+// ----------------------------------------------------------------------------
+// Folds a new sample of a switch row into its debounced state. Every column
+// whose sample differs from its state counts up; any that agree reset to
+// zero. A column that reaches four flips state.
+// ----------------------------------------------------------------------------
+static inline void debounce_row(uint8_t row, uint8_t sample)
+{
+  uint8_t delta = sample ^ sw_states[row];
+  uint8_t c0 = vc0[row];
+  uint8_t c1 = (vc1[row] ^ c0) & delta;
+  c0 = ~c0 & delta;
+  vc0[row] = c0;
+  vc1[row] = c1;
+  sw_states[row] ^= delta & ~(c0 | c1);
+}
+// ----------------------------------------------------------------------------
+// Notes the time of any button contact in a new sample of its row that
+// reads differently from its debounced state for the first time. The edge
+// came somewhere between this sample and the row's last one, so it is
+// stamped half way. Only the first sample counts, so bounce after it
+// doesn't move the time.
+// ----------------------------------------------------------------------------
+static inline void stamp_edges(uint8_t row, uint8_t sample, uint16_t t)
+{
+  uint8_t e = row - BTN_ROW0;
+  uint8_t fresh = (sample ^ sw_states[row]) & ~edge_valid[e];
+  uint16_t prev = row_time[row];
+  row_time[row] = t;
+  if(!fresh)
+    return;
+  edge_valid[e] |= fresh;
+  uint16_t mid = prev + ((uint16_t)(t - prev) >> 1);
+  for(uint8_t c=0;fresh;c++, fresh>>=1)
+    if(fresh & 1)
+      edge_time[e][c] = mid;
+}
+// ----------------------------------------------------------------------------
+// Starts a new telemetry period.
+// ----------------------------------------------------------------------------
+static void tm_reset(tm_stat_t *s)
+{
+  s->min = 0xFFFF;
+  s->max = 0;
+  for(uint8_t i=0;i<8;i++)
+    s->hist[i] = 0;
+}
+// ----------------------------------------------------------------------------
+// Adds a duration to a telemetry period.
+// ----------------------------------------------------------------------------
+static inline void tm_add(tm_stat_t *s, uint16_t us, uint8_t shift)
+{
+  if(us < s->min)
+    s->min = us;
+  if(us > s->max)
+    s->max = us;
+  uint16_t bin = us >> shift;
+  if(bin > 7)
+    bin = 7;
+  if(s->hist[bin] != 255)
+    s->hist[bin]++;
+}
+// ----------------------------------------------------------------------------
+static inline void put16(uint8_t *p, uint16_t v)
+{
+  p[0] = v & 0xFF;
+  p[1] = v >> 8;
+}
+// ----------------------------------------------------------------------------
+// Reports the timing of the scans since the last report, if a buffer is
+// free; if not, the next scan tries again.
+// ----------------------------------------------------------------------------
+static inline void send_telemetry(void)
+{
+  if(tx_status[tx_cur] == TWI_MSG_BUSY)
+    return;
+  uint8_t *p = tx_frame + 1 + KB_HEADER_LEN;
+  put16(p + KB_TM_SCAN_MIN, tm_scan.min);
+  put16(p + KB_TM_SCAN_MAX, tm_scan.max);
+  put16(p + KB_TM_LED_MIN, tm_led.min);
+  put16(p + KB_TM_LED_MAX, tm_led.max);
+  put16(p + KB_TM_OVERRUNS, tm_overruns);
+  KB_IRQ_OFF();  // the TWI interrupt updates these
+  put16(p + KB_TM_TWI_DROPPED, TWI_counters.dropped);
+  put16(p + KB_TM_TWI_ERRORS, TWI_counters.errors);
+  put16(p + KB_TM_TWI_RECOVERED, TWI_counters.recoveries);
+  KB_IRQ_ON();
+  for(uint8_t i=0;i<8;i++)
+  {
+    p[KB_TM_SCAN_HIST + i] = tm_scan.hist[i];
+    p[KB_TM_LED_HIST + i] = tm_led.hist[i];
+  }
+  send_frame(KB_FRAME_TELEMETRY, KB_TM_LEN);
+  tm_reset(&tm_scan);
+  tm_reset(&tm_led);
+  telemetry_ms = 0;
+}
+// ----------------------------------------------------------------------------
+// begins a full scan of the keyboard matrix
+// ----------------------------------------------------------------------------
+void scan_kb(void)
+{
+  // sample all 15 switch rows
+  for(uint8_t row=0;row<15;row++)
+  {
+    uint16_t t = KB_TIMER_US();
+    uint8_t b = KB_PIND();    // read the eight columns of the switch row
+    if(row < KB_ROW_ENC_CLICK)
+    {
+      row_time[row] = t;
+      sw_states[row] = b;
+    } else if(row < BTN_ROW0)
+    {
+      row_time[row] = t;
+      debounce_row(row, b);
+    } else
+    {
+      uint8_t was = sw_states[row];
+      stamp_edges(row, b, t);
+      debounce_row(row, b);
+      // an edge whose count has started over without the state changing
+      // was a glitch
+      edge_valid[row - BTN_ROW0] &= vc0[row] | vc1[row] | (was ^ sw_states[row]);
+    }
+    KB_PORTB_CLR(0x02); // SW_ROW_CLK = 0
+    KB_PORTB_SET(0x02);  // SW_ROW_CLK = 1
+  }
+  // re-select first switch row
+  KB_PORTB_CLR(0x01); // SW_ROW_DAT = 0
+  KB_PORTB_CLR(0x02); // SW_ROW_CLK = 0
+  KB_PORTB_SET(0x02);  // SW_ROW_CLK = 1
+  KB_PORTB_SET(0x01);  // SW_ROW_DAT = 1
+
+  scan_ms++;
+  keyframe_ms++;
+  send_changes();
+  if(++telemetry_ms >= KB_TELEMETRY_MS)
+    send_telemetry();
+  if(led_poll_due)
+    poll_leds();
+}
+// ----------------------------------------------------------------------------
+// Samples the button contact rows between scans, only to time their edges;
+// the scan still does all the debouncing and deciding. The main loop calls
+// this while it waits for the next tick, so an edge is timed to within one
+// pass of it, about 16 us, rather than to the scan period.
+// Leaves the first switch row selected, as the scan expects.
+// ----------------------------------------------------------------------------
+void kb_idle(void)
+{
+  for(uint8_t row=0;row<15;row++)
+  {
+    if(row >= BTN_ROW0)
+    {
+      uint16_t t = KB_TIMER_US();
+      stamp_edges(row, KB_PIND(), t);
+    }
+    KB_PORTB_CLR(0x02); // SW_ROW_CLK = 0
+    KB_PORTB_SET(0x02);  // SW_ROW_CLK = 1
+  }
+  // re-select first switch row
+  KB_PORTB_CLR(0x01); // SW_ROW_DAT = 0
+  KB_PORTB_CLR(0x02); // SW_ROW_CLK = 0
+  KB_PORTB_SET(0x02);  // SW_ROW_CLK = 1
+  KB_PORTB_SET(0x01);  // SW_ROW_DAT = 1
+}
+// ----------------------------------------------------------------------------
+// Puts the core in its power-up state. Call before enabling interrupts.
+// ----------------------------------------------------------------------------
+void kb_core_init(void)
+{
+  // all switches start out open, until the debouncer hears otherwise
+  for(uint8_t row=0;row<KB_MATRIX_ROWS;row++)
+    sw_states[row] = 0xFF;
+  led_rx[0] = (TWI_targetSlaveAddress << TWI_ADR_BITS) | (TRUE << TWI_READ_BIT);
+  tm_reset(&tm_scan);
+  tm_reset(&tm_led);
+}
+// ----------------------------------------------------------------------------
+// One timer 0 tick's work: an LED row refresh, unless we are catching up
+// after an overrun, then a full scan of the keyboard, each timed for the
+// telemetry.
+// ----------------------------------------------------------------------------
+void kb_tick(void)
+{
+  uint16_t t0 = KB_TIMER_US();
+  if(skip_led)
+    skip_led = 0;
+  else
+  {
+    refresh_led_row();
+    if(cur_led_row == 0)  // row 5 is up; new levels can start at row 0
+      take_led_frame();
+    tm_add(&tm_led, KB_TIMER_US() - t0, TM_LED_SHIFT);
+  }
+  uint16_t t1 = KB_TIMER_US();
+  scan_kb();
+  TWI_Service();
+  tm_add(&tm_scan, KB_TIMER_US() - t1, TM_SCAN_SHIFT);
+}
+// ----------------------------------------------------------------------------
+// The last tick ran into the next one: count it, and catch up by leaving
+// out the next LED row refresh.
+// ----------------------------------------------------------------------------
+void kb_overrun(void)
+{
+  tm_overruns++;
+  skip_led = 1;
+}
+///////////////////////////////////////////////////////////////////////////////
+// EOF
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,40 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// kb_core.h
+//
+// The keyboard controller's scan, debounce, velocity, encoder, LED and
+// framing logic. It reaches the hardware only through kb_port.h, and the
+// Pico only through the TWI_Master.h queue, so the same code runs on the
+// ATmega and against the simulator in host/.
+//
+// main.c owns the timers: every timer 0 tick it calls kb_tick(), and if the
+// next tick has already come by the time that returns, kb_overrun(). Timer
+// 0's compare B interrupt calls led_bam_step(). In between ticks it calls
+// kb_idle() over and over, which times button contact edges.
+//
+///////////////////////////////////////////////////////////////////////////////
+#ifndef __KB_CORE_H__
+#define __KB_CORE_H__
+
+#include <stdint.h>
+
+#define MAIN_CPU_HZ     8000000.0
+#define KB_FULLSCAN_HZ  1000.0    // (333 Hz LED update rate)
+#define TIMER0_TOP      ((uint8_t)(MAIN_CPU_HZ / 256.0 / KB_FULLSCAN_HZ))
+
+extern uint16_t scan_ms;          // scan timestamp, one tick per full scan
+
+void kb_core_init(void);
+void regs_reset(void);
+void regs_clear(void);
+void refresh_led_row(void);
+void scan_kb(void);
+void kb_tick(void);
+void kb_overrun(void);
+void kb_idle(void);
+void led_bam_step(void);
+
+#endif
+///////////////////////////////////////////////////////////////////////////////
+// EOF
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,56 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// kb_port.h
+//
+// Hardware access for kb_core.c. On the ATmega these are the real port,
+// timer and interrupt registers. Built with KB_HOST defined, they call the
+// switch matrix and shift register simulator in host/ instead, so the scan
+// logic can be run and measured on a PC.
+//
+// PORTB: 5: LED_COL_CLK, 4: LED_COL_DAT, 3: LED_ROW_CLK, 2: LED_ROW_DAT,
+//        1: SW_ROW_CLK,  0: SW_ROW_DAT
+// PORTC: 0: SHIFTREGS_RESET
+// PIND:  the eight switch columns of the selected row
+//
+///////////////////////////////////////////////////////////////////////////////
+#ifndef __KB_PORT_H__
+#define __KB_PORT_H__
+
+#ifdef KB_HOST
+
+#include "kb_sim.h"
+
+#define KB_PORTB_SET(m)     kb_sim_portb_set(m)
+#define KB_PORTB_CLR(m)     kb_sim_portb_clr(m)
+#define KB_PORTC_SET(m)     kb_sim_portc_set(m)
+#define KB_PORTC_CLR(m)     kb_sim_portc_clr(m)
+#define KB_PIND()           kb_sim_pind()
+#define KB_TIMER_US()       kb_sim_timer_us()     // timer 1, 1 MHz
+#define KB_BAM_COMPARE(v)   kb_sim_bam_compare(v) // timer 0 compare B
+#define KB_IRQ_OFF()        kb_sim_irq(0)
+#define KB_IRQ_ON()         kb_sim_irq(1)
+#define PROGMEM
+#define pgm_read_byte(p)    (*(const uint8_t *)(p))
+
+#else
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+
+#define KB_PORTB_SET(m)     (PORTB |= (m))
+#define KB_PORTB_CLR(m)     (PORTB &= ~(m))
+#define KB_PORTC_SET(m)     (PORTC |= (m))
+#define KB_PORTC_CLR(m)     (PORTC &= ~(m))
+#define KB_PIND()           PIND
+#define KB_TIMER_US()       TCNT1
+#define KB_BAM_COMPARE(v)   (OCR0B = (v))
+#define KB_IRQ_OFF()        cli()
+#define KB_IRQ_ON()         sei()
+
+#endif
+
+#endif
+///////////////////////////////////////////////////////////////////////////////
+// EOF
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,138 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// kb_proto.h
+//
+// Wire format of the frames the keyboard controller writes to the Pico's
+// I2C slave (address 0x30). A copy of this file lives in each firmware
+// folder, software/atmega328p_keys_and_leds and software/pi_pico_w. Keep
+// the two identical.
+//
+// Nothing is sent while the keys are still. A scan that sees changes sends
+// a delta frame of events. A keyframe with the whole matrix goes out every
+// KB_KEYFRAME_MS, and whenever a scan has more events than fit in one
+// frame, so the Pico can resync after a lost frame.
+//
+// Every frame starts with a four byte header:
+//
+//   [0] frame kind (KB_FRAME_*) in bits 7..6, sequence number in bits 5..0.
+//       The sequence counts every frame sent, so a gap means a lost frame.
+//   [1] scan timestamp, ms, low byte
+//   [2] scan timestamp, ms, high byte
+//   [3] sequence number of the last LED frame the controller took in
+//
+// KB_FRAME_EVENTS payload: up to KB_MAX_EVENTS two byte events
+//
+//   [0] event type (KB_EV_*) in bits 7..6, id in bits 5..0
+//   [1] value
+//
+// KB_FRAME_KEYFRAME payload: KB_MATRIX_ROWS matrix rows, one bit per
+// column, zero meaning closed. The buttons' normally-open rows hold the
+// velocity engine's key state instead of the raw contacts, zero = down.
+//
+// KB_FRAME_TELEMETRY payload: KB_TM_LEN bytes about the controller's own
+// timing, sent every KB_TELEMETRY_MS. 16-bit values are little-endian, and
+// times are in microseconds. Minimums, maximums and histograms cover the
+// scans since the last report; the other counts are running totals.
+//
+// LED frame: once per LED refresh cycle the controller reads the LED state
+// back from the same address, after a repeated START if it has a frame to
+// write, or on its own if not. The Pico answers with KB_LED_FRAME_LEN bytes
+// it keeps ready:
+//
+//   [0] LED frame sequence number; the controller skips a frame it has
+//   [1] number of commands, 0..KB_LED_MAX_CMDS
+//   [2 + 4 * n] commands, each setting one LED's mode:
+//       [0] LED, numbered like the buttons
+//       [1] mode (KB_LED_*), with the chase position and length for a chase
+//       [2] level, 0 (off) to 15
+//       [3] rate: the mode's time step is 2^rate ms
+//
+// The controller animates the LEDs itself from its scan clock, so the Pico
+// only sends changes. After taking a frame in, the controller echoes its
+// sequence number in the next frame header it writes; the Pico holds back
+// further changes until then, and sends them all in the next LED frame.
+//
+// Modes, with t the controller's scan time in ms and step = t >> rate:
+//
+//   steady  always at level
+//   blink   at level while bit 0 of step is clear, else off
+//   pulse   ramps 0 -> level -> 0 over 32 steps
+//   chase   at level while step modulo the length equals the position, else
+//           off. LEDs with the same rate and length chase together.
+//
+///////////////////////////////////////////////////////////////////////////////
+#ifndef __KB_PROTO_H__
+#define __KB_PROTO_H__
+
+#define KB_MATRIX_ROWS      15
+#define KB_HEADER_LEN       4
+#define KB_MAX_EVENTS       8
+#define KB_KEYFRAME_MS      500
+
+// frame kinds
+#define KB_FRAME_EVENTS     0x40
+#define KB_FRAME_KEYFRAME   0x80
+#define KB_FRAME_TELEMETRY  0xC0
+#define KB_FRAME_KIND_MASK  0xC0
+#define KB_SEQ_MASK         0x3F
+
+// event types
+#define KB_EV_RELEASE       0x00  // id: key,         value: velocity 1..127
+#define KB_EV_PRESS         0x40  // id: key,         value: velocity 1..127
+#define KB_EV_ENCODER       0x80  // id: encoder 0..7, value: signed detents
+#define KB_EV_RAW           0xC0  // id: matrix row,  value: row bits
+#define KB_EV_TYPE_MASK     0xC0
+#define KB_EV_ID_MASK       0x3F
+
+// key ids
+#define KB_ID_BUTTON(row, col)  ((row) * 8 + (col))   // 0..47, row 0..5
+#define KB_ID_ENC_CLICK(n)      (48 + (n))            // 48..55
+#define KB_NUM_KEYS             56
+
+// matrix rows
+#define KB_ROW_ENC_A        0
+#define KB_ROW_ENC_B        1
+#define KB_ROW_ENC_CLICK    2
+#define KB_ROW_BTN_NO(r)    (3 + 2 * (r))   // normally-open contact of button row r
+#define KB_ROW_BTN_NC(r)    (4 + 2 * (r))   // normally-closed contact
+
+#define KB_FRAME_MAX_LEN    (KB_HEADER_LEN + 2 * KB_MAX_EVENTS)
+
+// telemetry payload offsets
+#define KB_TELEMETRY_MS     250
+#define KB_TM_SCAN_MIN      0   // scan, including its frames, 16 bits
+#define KB_TM_SCAN_MAX      2
+#define KB_TM_LED_MIN       4   // LED row refresh, 16 bits
+#define KB_TM_LED_MAX       6
+#define KB_TM_OVERRUNS      8   // scans that ran past the next tick, 16 bits
+#define KB_TM_TWI_DROPPED   10  // TWI driver counters, 16 bits
+#define KB_TM_TWI_ERRORS    12
+#define KB_TM_TWI_RECOVERED 14
+#define KB_TM_SCAN_HIST     16  // 8 one-byte bins of KB_TM_SCAN_BIN_US
+#define KB_TM_LED_HIST      24  // 8 one-byte bins of KB_TM_LED_BIN_US
+#define KB_TM_LEN           32
+#define KB_TM_SCAN_BIN_US   128 // the last bin also holds anything longer
+#define KB_TM_LED_BIN_US    16
+#define KB_TM_FRAME_LEN     (KB_HEADER_LEN + KB_TM_LEN)
+
+// LEDs, numbered like the buttons
+#define KB_NUM_LEDS         48
+#define KB_LED_ROWS         6
+#define KB_LED_MAX_CMDS     6
+#define KB_LED_CMD_LEN      4
+#define KB_LED_FRAME_LEN    (2 + KB_LED_MAX_CMDS * KB_LED_CMD_LEN)
+
+// LED modes
+#define KB_LED_STEADY       0x00
+#define KB_LED_BLINK        0x40
+#define KB_LED_PULSE        0x80
+#define KB_LED_CHASE        0xC0
+#define KB_LED_MODE_MASK    0xC0
+#define KB_LED_CHASE_MODE(pos, len) (KB_LED_CHASE | ((pos) << 3) | ((len) - 1))  // len 1..8
+#define KB_LED_CHASE_POS(m)         (((m) >> 3) & 7)
+#define KB_LED_CHASE_LEN(m)         (((m) & 7) + 1)
+
+#endif
+///////////////////////////////////////////////////////////////////////////////
+// EOF
+///////////////////////////////////////////////////////////////////////////////
@@ -95,10 +95,101 @@
 // but we can update the LED matrix much slower: one LED row for every full
 // scan of the KB, or all LED rows will be updated every six KB scans.
 //
+// LED brightness uses bit-angle modulation. Each LED has a 4-bit level,
+// and just before a row is shown its levels are turned into four bit
+// planes. While a row is selected, its planes are
+// shifted out in turn, each shown for a time proportional to its bit
+// weight: 8/16, 4/16, 2/16 and 1/16 of the scan tick, with the last 1/16
+// dark. Timer 0's compare B interrupt times the plane changes. Every row
+// costs the same four shift-outs whatever its levels, and the scan itself
+// is untouched.
+//
+// The levels come from a mode table: each LED is steady, blinking, pulsing
+// or part of a chase, at a rate given as a power of two milliseconds. The
+// modes are worked out against the scan clock as each row comes up, so
+// animations run here, smoothly, and the Pico only sends mode changes.
+//
 // As keyboard events occur, we queue them for output to the main CPU,
 // a Raspberry Pi Pico-W. The interface is a two-wire I2C bus.
 //
-// As keyboard events go out to the Pico, LED state changes come back in.
+// Each scan is compared with the switch states the Pico already knows
+// about, and only the differences go out, as press, release and raw-row
+// events stamped with the scan time. A quiet keyboard sends nothing except
+// a full-matrix keyframe every KB_KEYFRAME_MS, which lets the Pico resync
+// if it ever misses a frame; it waits for a scan with no events, so it
+// never stands in for them. The frame format is in kb_proto.h.
+//
+// Frames are only queued by the scan; the TWI interrupt sends them in the
+// background, so a slow or stuck Pico can't stall scanning. TWI_Service(),
+// called once per scan, recovers the bus if a transfer stops making
+// progress. Scans build frames in two ping-pong buffers, and the driver
+// sends straight from them, clearing a buffer's busy flag when it is done.
+// If a scan finds both buffers still busy, its changes are dropped and a
+// keyframe follows as soon as a buffer frees up.
+//
+// VELOCITY
+//
+// Each button has a small state machine. A press starts when the normally-
+// closed contact opens and ends when the normally-open contact closes; a
+// release is the same in reverse. The time in between goes through a
+// velocity curve (KB_VEL_FAST_US, KB_VEL_SLOW_US and vel_curve) to give the
+// 7-bit velocity sent with the press or release event.
+//
+// The contact edges are timed with timer 1, which free-runs at 1 MHz.
+// Between scans the main loop keeps sampling the button rows (kb_idle()).
+// The first sample in which a contact reads differently from its debounced
+// state stamps the edge, half way back to the row's previous sample. A pass
+// over the rows takes about 16 us, so edges are timed to within 8 us or so
+// rather than to the 1 ms scan period. The scan stamps edges the
+// same way, for when an overrun leaves no time in between.
+//
+// DEBOUNCE
+//
+// The clicky switches bounce, so rows 2-14 are debounced before anything
+// looks at them. Each row has a two-bit vertical counter: bit 0 of every
+// column's count is in vc0[row] and bit 1 in vc1[row], so all eight columns
+// count together in a few logic instructions. A column changes state after
+// four scans in a row that disagree with it. Velocity timing comes from the
+// edge stamps, so the delay doesn't touch it; an edge whose count starts
+// over before the state changes was a glitch, and its stamp is dropped. The
+// encoder quadrature rows 0 and 1 are left raw, since the quadrature
+// decoding already ignores bounce and four scans is too slow for a spinning
+// knob.
+//
+// ENCODERS
+//
+// The A/B lines of all eight encoders are decoded here, so the Pico only
+// gets signed detent counts. Encoders whose lines changed are found for all
+// eight at once with a couple of XORs. Each one then looks up its
+// old and new A/B state in a transition table, which gives +1, -1 or 0
+// quarter steps. If both lines changed between scans, the knob moved two
+// quarter steps and we assume the direction of its last step. At rest (both
+// contacts open) the quarter steps are rounded to a detent. Detents that
+// come quickly after the one before are multiplied by 2 or 4, so a quick
+// spin covers a long range.
+//
+// TELEMETRY
+//
+// Every scan and LED row refresh is timed with timer 1, and the minimum,
+// maximum and a histogram of each go to the Pico every KB_TELEMETRY_MS,
+// along with the TWI driver's error counts. A scan that runs into the next
+// tick is counted as an overrun, and the following tick leaves out its LED
+// row refresh to catch up, so an overloaded keyboard dims a little instead
+// of stopping.
+//
+// As keyboard events go out to the Pico, LED state comes back in. Once per
+// LED refresh cycle, the next key frame to go out is followed by a repeated
+// START and a read of the Pico's LED frame, so key events and LED feedback
+// share one bus transaction. If the keys are quiet the LED frame is read on
+// its own. A new frame's mode changes are applied at the start of a refresh
+// cycle, and its sequence number goes back in the next frame header as an
+// acknowledgement; a frame goes out for that even if there are no events.
+//
+// SOURCE LAYOUT
+//
+// This file sets up the hardware and runs the main loop. Everything above
+// is in kb_core.c, which reaches the ports only through kb_port.h, so it
+// also builds on a PC against the simulated matrix in host/.
 //
 // Created: 6/19/2023 9:52:17 PM
 // Author : Craig Iannello  www.pugbutt.com
@@ -107,14 +198,7 @@
 #include <avr/io.h>
 #include <avr/interrupt.h>
 #include "TWI_Master.h"
-// ----------------------------------------------------------------------------
-#define MAIN_CPU_HZ     8000000.0
-#define KB_FULLSCAN_HZ  1000.0    // (333 Hz LED update rate)
-// ----------------------------------------------------------------------------
-uint8_t sw_states[16];
-uint8_t led_states[6];
-uint8_t cur_led_row = 0;  // current led row for refresh
-unsigned char TWI_targetSlaveAddress = 0x30;
+#include "kb_core.h"
 // ----------------------------------------------------------------------------
 // timer ISR sets this flag to tell main-loop to scan the key matrix again
 // ----------------------------------------------------------------------------
@@ -142,144 +226,43 @@ void init(void)
   // disable interrupts
   cli();
   // timer 0 : Each rollover starts a full scan of the key matrix
-  // and updates 1 of the 6 LED rows
-  // timer 0 - Fast PWM, rollover at TOP (OCR0A) , prescaler: clk/256
-  TCCR0A = 0x03;
-  TCCR0B = 0x0C;
+  // and updates 1 of the 6 LED rows. Compare B steps through the LED
+  // bit planes in between.
+  // timer 0 - CTC, rollover at TOP (OCR0A) , prescaler: clk/256
+  // (CTC rather than fast PWM, so OCR0B changes take effect at once)
+  TCCR0A = 0x02;
+  TCCR0B = 0x04;
   // timer 0 - set TOP value for desired rollover rate
-  OCR0A = MAIN_CPU_HZ / 256.0 / KB_FULLSCAN_HZ;
-  // enable timer 0 rollover interrupt
-  TIMSK0 = 0x01;
+  OCR0A = TIMER0_TOP;
+  OCR0B = TIMER0_TOP;
+  // enable timer 0 compare A (rollover) and compare B interrupts
+  TIMSK0 = (1<<OCIE0A)|(1<<OCIE0B);
+
+  // timer 1 : free-running 1 MHz timestamp clock for velocity timing
+  // timer 1 - Normal mode, prescaler: clk/8
+  TCCR1A = 0x00;
+  TCCR1B = 0x02;
 
   // Setup our main output interface (i2c) to the Pi Pico W (main) CPU.
   TWI_Master_Initialise();
+  kb_core_init();
 
   // enable interrupts
   sei();
 }
 // ----------------------------------------------------------------------------
-ISR (TIMER0_OVF_vect)
+ISR (TIMER0_COMPA_vect)
 {
   kb_scan_flag = 1;
 }
 // ----------------------------------------------------------------------------
-// Initialize the state of all shift registers.
-// Selects the first row each of both the switch and the LED matrices.
-// ----------------------------------------------------------------------------
-inline void regs_reset(void)
-{
-  // De-select all switch rows, all led rows, and all LED columns
-  PORTB |=  0x11;  // LED_COL_DAT = 1, SW_ROW_DAT = 1
-  PORTB &= ~0x04;  // LED_ROW_DAT = 0
-  for (uint8_t i=0;i<16;i++)
-  {
-    PORTB &= ~0x2A; // start clock pulses on led row, sw row, and sw col
-    PORTB |=  0x2A; // end clock pulses
-  }
-  // clock a single 0 into the sw row reg to select the first sw row,
-  // and clock a single 1 into the led row reg to select the first led row
-  PORTB &= 0xFE;  // SW_ROW_DAT = 0
-  PORTB |= 0x04;  // LED_ROW_DAT = 1
-  PORTB &= ~0x0A; // LED_ROW_CLK = 0, SW_ROW_CLK = 0
-  PORTB |= 0x0A;  // LED_ROW_CLK = 1, SW_ROW_CLK = 1
-  PORTB &= ~0x04; // LED_ROW_DAT = 0
-  PORTB |= 0x01;  // SW_ROW_DAT = 1
-}
-// ----------------------------------------------------------------------------
-// resets all shift regs to 0's - not really very useful
-// ----------------------------------------------------------------------------
-inline void regs_clear(void)
-{
-  PORTC &= 0xFE; // start reset pulse
-  PORTC |= 0x01; // end reset pulse
-}
-// ----------------------------------------------------------------------------
-// Shifts 8 bits into the LED columns register. Bits which are set will cause
-// the corresponding LED to be lit on the currently selected row.
-// ----------------------------------------------------------------------------
-inline void set_led_row(uint8_t cols)
-{
-  for(uint8_t i=0;i<8;i++)
-  {
-    PORTB &= ~0x10;    // LED_COL_DAT = 0
-    if(!(cols&1))
-      PORTB|= 0x10;   // LED_COL_DAT = NOT cols.LSB
-    // clock the bit value into the cols register
-    PORTB &= ~0x20;   // LED_COL_CLK = 0
-    PORTB |= 0x20;    // LED_COL_CLK = 1
-    cols>>=1;         // select next bit of cols value
-  }
-}
-// ----------------------------------------------------------------------------
-inline void refresh_led_row(void)
+ISR (TIMER0_COMPB_vect)
 {
-  set_led_row(led_states[cur_led_row]);
-  cur_led_row++;
-  if(cur_led_row == 6) // if finished all LED rows
-  {
-    // reselect first row of leds
-    cur_led_row = 0;
-    PORTB |= 0x04;  // LED_ROW_DAT = 1
-    PORTB &= ~0x08; // LED_ROW_CLK = 0
-    PORTB |= 0x08;  // LED_ROW_CLK = 1
-    // don't select more than one LED row at a time
-    PORTB &= ~0x04; // LED_ROW_DAT = 0
-  } else  // still have led rows left to update
-  {
-    // select next led row
-    PORTB &= ~0x08; // LED_ROW_CLK = 0
-    PORTB |= 0x08;  // LED_ROW_CLK = 1
-  }
-}
-// ----------------------------------------------------------------------------
-// begins a full scan of the keyboard matrix
-// ----------------------------------------------------------------------------
-inline void scan_kb(void)
-{
-  // sample all 15 switch rows
-  for(uint8_t row=0;row<15;row++)
-  {
-    uint8_t b = PIND;
-    sw_states[row+1] = b;  // read the eight columns of the switch row
-    PORTB &= ~0x02; // SW_ROW_CLK = 0
-    PORTB |= 0x02;  // SW_ROW_CLK = 1
-  }
-  sw_states[0] = TWI_targetSlaveAddress << 1;
-  TWI_Start_Transceiver_With_Data( sw_states, 16 );
-  // re-select first switch row
-  PORTB &= ~0x01; // SW_ROW_DAT = 0
-  PORTB &= ~0x02; // SW_ROW_CLK = 0
-  PORTB |= 0x02;  // SW_ROW_CLK = 1
-  PORTB |= 0x01;  // SW_ROW_DAT = 1
-}
-// ----------------------------------------------------------------------------
-// indicate error state by forever animating first row of LEDs
-// ----------------------------------------------------------------------------
-void do_guru_meditation()
-{
-  uint16_t guru_ticks=0;
-  uint8_t v = 0x80;
-  regs_reset();
-  while(1)
-  {
-    if(kb_scan_flag)
-    {
-      kb_scan_flag=0;
-      if(++guru_ticks > 40)
-      {
-        guru_ticks = 0;
-        set_led_row(v);
-        v>>=1;
-        if(v==0)
-          v=0x80;
-      }
-    }
-  }
+  led_bam_step();
 }
 // ----------------------------------------------------------------------------
 int main(void)
 {
-    uint8_t rows = 0;
     init();       // init MCU IO and timers
     regs_clear();
     regs_reset(); // select first switch row and first LED row
@@ -288,18 +271,12 @@ int main(void)
       if(kb_scan_flag)
       {
         kb_scan_flag = 0;
-        refresh_led_row();
-        scan_kb();
-        if(++rows==12)
-        {
-          rows=0;
-          led_states[rand()%6] = rand()%256;
-        }
-        if(kb_scan_flag)  // too slow! go into guru meditation mode
-        {
-          do_guru_meditation();
-        }
+        kb_tick();
+        if(kb_scan_flag)  // too slow! catch up by skipping an LED row
+          kb_overrun();
       }           // finished a scan of the keyboard
+      else
+        kb_idle();  // time contact edges until the next tick
     }             // end main-loop
 }
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,96 @@
+#include <string.h>
+#include "adpcm.h"
+
+const int16_t adpcm_step_table[89] =
+{
+  7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
+  34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143,
+  157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658,
+  724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024,
+  3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+  15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+const int8_t adpcm_index_table[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+
+// Decodes the first 'frames' frames of a block, up to ADPCM_BLOCK_FRAMES.
+void adpcm_decode_block(const uint8_t *blk, int16_t *out, uint32_t frames)
+{
+  adpcm_state_t s;
+  if(!frames)
+    return;
+  out[0] = adpcm_block_start(&s, blk);
+  if(frames > ADPCM_BLOCK_FRAMES)
+    frames = ADPCM_BLOCK_FRAMES;
+  for(uint32_t n=1;n<frames;n++)
+    out[n] = adpcm_decode(&s, adpcm_nibble(blk, n));
+}
+
+// Encodes one block, from step index 'index', into 'out'. Each nibble is
+// the one that decodes nearest the input. Returns the squared error.
+static uint64_t encode_block(const int16_t *in, uint32_t frames, int32_t index, uint8_t *out)
+{
+  adpcm_state_t s = { in[0], index };
+  uint64_t err = 0;
+  memset(out, 0, ADPCM_BLOCK_BYTES);
+  out[0] = s.pred & 0xFF;
+  out[1] = (s.pred >> 8) & 0xFF;
+  out[2] = index;
+  for(uint32_t n=1;n<ADPCM_BLOCK_FRAMES;n++)
+  {
+    int32_t x = n < frames ? in[n] : 0;
+    int32_t diff = x - s.pred;
+    uint32_t nibble = 0;
+    if(diff < 0)
+    {
+      nibble = 8;
+      diff = -diff;
+    }
+    // the magnitude whose step, summed as adpcm_decode() sums it, lands
+    // nearest
+    int32_t step = adpcm_step_table[s.index];
+    int32_t best = INT32_MAX;
+    uint32_t mag = 0;
+    for(uint32_t k=0;k<8;k++)
+    {
+      int32_t d = (step >> 3) + (k & 4 ? step : 0) + (k & 2 ? step >> 1 : 0) + (k & 1 ? step >> 2 : 0);
+      int32_t e = d > diff ? d - diff : diff - d;
+      if(e < best)
+      {
+        best = e;
+        mag = k;
+      }
+    }
+    nibble |= mag;
+    int32_t e = x - adpcm_decode(&s, nibble);
+    if(n < frames)
+      err += (int64_t)e * e;
+    out[ADPCM_HEADER_BYTES + ((n - 1) >> 1)] |= n & 1 ? nibble : nibble << 4;
+  }
+  return err;
+}
+
+// Encodes a whole sample into adpcm_bytes(frames) bytes. Since every block
+// stands alone, each starts on whichever step index encodes it best,
+// rather than the one the last block ended on; that matters most for
+// short loops, which replay their first block's attack every time round.
+// The last block is padded with silence.
+void adpcm_encode(const int16_t *in, uint32_t frames, uint8_t *out)
+{
+  for(uint32_t first=0;first<frames;first+=ADPCM_BLOCK_FRAMES, out+=ADPCM_BLOCK_BYTES)
+  {
+    uint32_t n = frames - first < ADPCM_BLOCK_FRAMES ? frames - first : ADPCM_BLOCK_FRAMES;
+    int32_t best_index = 0;
+    uint64_t best = UINT64_MAX;
+    for(int32_t index=0;index<=88;index++)
+    {
+      uint64_t err = encode_block(in + first, n, index, out);
+      if(err < best)
+      {
+        best = err;
+        best_index = index;
+      }
+    }
+    encode_block(in + first, n, best_index, out);
+  }
+}
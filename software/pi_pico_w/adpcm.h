@@ -0,0 +1,80 @@
+#ifndef __ADPCM_H__
+#define __ADPCM_H__
+
+#include <stdint.h>
+
+// IMA-ADPCM, 4 bits a frame, for storing mono samples at a quarter of
+// their 16-bit size.
+//
+// A sample is a run of ADPCM_BLOCK_BYTES blocks, each decodable on its own.
+// A block starts with its first frame as plain 16-bit PCM and the step
+// index to go on from, then packs a nibble per frame after that, low nibble
+// first. This is the mono layout of IMA-ADPCM WAV files with a block align
+// of 128 bytes. A frame anywhere in a sample can be reached by decoding at
+// most one block from its start, and the first frame of a block is there
+// without decoding at all.
+//
+// The decoder is inline so the sampler's render loop can step it a frame at
+// a time. The encoder is for the host importer, but builds anywhere.
+
+#define ADPCM_BLOCK_BYTES   128
+#define ADPCM_HEADER_BYTES  4
+#define ADPCM_BLOCK_FRAMES  (1 + (ADPCM_BLOCK_BYTES - ADPCM_HEADER_BYTES) * 2)
+
+typedef struct
+{
+  int32_t pred;             // last frame decoded
+  int32_t index;            // into adpcm_step_table
+} adpcm_state_t;
+
+extern const int16_t adpcm_step_table[89];
+extern const int8_t adpcm_index_table[8];
+
+// Bytes taken by a sample of 'frames' frames.
+static inline uint32_t adpcm_bytes(uint32_t frames)
+{
+  return (frames + ADPCM_BLOCK_FRAMES - 1) / ADPCM_BLOCK_FRAMES * ADPCM_BLOCK_BYTES;
+}
+
+// The first frame of a block, which is stored as it is.
+static inline int32_t adpcm_block_first(const uint8_t *blk)
+{
+  return (int16_t)(blk[0] | blk[1] << 8);
+}
+
+// Sets the decoder up at the start of a block. Returns its first frame.
+static inline int32_t adpcm_block_start(adpcm_state_t *s, const uint8_t *blk)
+{
+  s->pred = adpcm_block_first(blk);
+  s->index = blk[2] > 88 ? 88 : blk[2];
+  return s->pred;
+}
+
+// The nibble of frame n (1 .. ADPCM_BLOCK_FRAMES-1) of a block.
+static inline uint32_t adpcm_nibble(const uint8_t *blk, uint32_t n)
+{
+  uint8_t b = blk[ADPCM_HEADER_BYTES + ((n - 1) >> 1)];
+  return n & 1 ? b & 0x0F : b >> 4;
+}
+
+static inline int32_t adpcm_decode(adpcm_state_t *s, uint32_t nibble)
+{
+  int32_t step = adpcm_step_table[s->index];
+  int32_t diff = step >> 3;
+  if(nibble & 4)
+    diff += step;
+  if(nibble & 2)
+    diff += step >> 1;
+  if(nibble & 1)
+    diff += step >> 2;
+  int32_t p = nibble & 8 ? s->pred - diff : s->pred + diff;
+  s->pred = p > 32767 ? 32767 : p < -32768 ? -32768 : p;
+  int32_t i = s->index + adpcm_index_table[nibble & 7];
+  s->index = i < 0 ? 0 : i > 88 ? 88 : i;
+  return s->pred;
+}
+
+void adpcm_decode_block(const uint8_t *blk, int16_t *out, uint32_t frames);
+void adpcm_encode(const int16_t *in, uint32_t frames, uint8_t *out);
+
+#endif
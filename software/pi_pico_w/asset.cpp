@@ -0,0 +1,57 @@
+#include "asset.h"
+
+// Decodes pixels [x, x+w) of row y into 'line' as RGB565.
+void asset_decode_row(const ui_asset_t *a, int16_t x, int16_t y, int16_t w, uint16_t *line)
+{
+  const uint8_t *p = a->runs + a->row_offs[y];
+  const uint16_t *pal = a->palette;
+  const uint8_t bits = a->idx_bits;
+  const uint8_t mask = (1 << bits) - 1;
+  int16_t col = 0;
+  uint8_t idx;
+  int16_t len;
+
+  // skip the runs that end left of x
+  while(1)
+  {
+    if(bits == 8)
+    {
+      idx = p[0];
+      len = p[1] + 1;
+      p += 2;
+    } else
+    {
+      idx = *p & mask;
+      len = (*p >> bits) + 1;
+      p++;
+    }
+    if(col + len > x)
+      break;
+    col += len;
+  }
+
+  // first run may start left of x
+  len -= x - col;
+  while(1)
+  {
+    if(len > w)
+      len = w;
+    uint16_t c = pal[idx];
+    w -= len;
+    while(len--)
+      *line++ = c;
+    if(!w)
+      break;
+    if(bits == 8)
+    {
+      idx = p[0];
+      len = p[1] + 1;
+      p += 2;
+    } else
+    {
+      idx = *p & mask;
+      len = (*p >> bits) + 1;
+      p++;
+    }
+  }
+}
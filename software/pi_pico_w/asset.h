@@ -0,0 +1,30 @@
+#ifndef __ASSET_H__
+#define __ASSET_H__
+
+#include <stdint.h>
+
+// Compressed UI image format.
+//
+// Images are palette indexed and run-length encoded row by row, and are
+// made from GIMP dumps, PPMs or raw RGB565 by host/asset_conv. Each row
+// starts at a known offset, so any rectangle can be decoded straight into a
+// display line buffer without touching the rest of the image.
+//
+// With idx_bits < 8, a run is one byte: the palette index is in the low
+// idx_bits bits and (length - 1) is in the rest. With idx_bits == 8, a run
+// is two bytes: the index, then (length - 1). Runs never cross a row.
+
+typedef struct
+{
+  uint16_t        width;
+  uint16_t        height;
+  uint8_t         idx_bits;   // 1..8
+  uint16_t        ncolors;
+  const uint16_t *palette;    // RGB565
+  const uint32_t *row_offs;   // height entries, byte offset into runs
+  const uint8_t  *runs;
+} ui_asset_t;
+
+void asset_decode_row(const ui_asset_t *a, int16_t x, int16_t y, int16_t w, uint16_t *line);
+
+#endif
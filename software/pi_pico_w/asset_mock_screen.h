@@ -0,0 +1,2311 @@
+#ifndef __ASSET_MOCK_SCREEN_H__
+#define __ASSET_MOCK_SCREEN_H__
+
+// Generated by host/asset_conv. Do not edit.
+// 480x320, 8 colors, 36074 bytes of runs
+
+#include "asset.h"
+
+static const uint16_t asset_mock_screen_palette[8] = {
+  0x0000, 0x4CBD, 0x1106, 0x2AB0, 0xFFFF, 0x9E9F, 0xE73F, 0x2106
+};
+
+static const uint32_t asset_mock_screen_row_offs[320] = {
+  0, 15, 30, 47, 65, 98, 155, 239, 332, 423,
+  508, 598, 692, 784, 869, 929, 988, 1056, 1121, 1190,
+  1275, 1362, 1484, 1581, 1705, 1790, 1870, 1938, 2007, 2074,
+  2134, 2193, 2252, 2315, 2376, 2435, 2494, 2598, 2701, 2821,
+  2959, 3016, 3061, 3079, 3112, 3169, 3276, 3403, 3516, 3623,
+  3734, 3849, 3964, 4059, 4120, 4188, 4252, 4310, 4375, 4450,
+  4527, 4613, 4700, 4790, 4860, 4937, 4998, 5061, 5126, 5191,
+  5256, 5315, 5372, 5429, 5488, 5545, 5639, 5733, 5839, 5961,
+  6020, 6065, 6083, 6099, 6114, 6129, 6161, 6205, 6329, 6520,
+  6699, 6924, 7102, 7284, 7415, 7459, 7535, 7647, 7765, 8017,
+  8135, 8257, 8343, 8387, 8503, 8673, 8839, 9057, 9225, 9397,
+  9519, 9563, 9645, 9763, 9881, 10133, 10251, 10369, 10455, 10499,
+  10601, 10751, 10897, 11127, 11279, 11437, 11543, 11587, 11669, 11791,
+  11913, 12165, 12283, 12405, 12491, 12535, 12653, 12835, 13011, 13233,
+  13409, 13589, 13713, 13757, 13839, 13961, 14083, 14335, 14457, 14579,
+  14665, 14709, 14818, 14983, 15138, 15364, 15527, 15698, 15811, 15855,
+  15937, 16059, 16181, 16437, 16559, 16681, 16767, 16811, 16934, 17115,
+  17288, 17502, 17677, 17860, 17985, 18029, 18111, 18229, 18347, 18599,
+  18717, 18835, 18921, 18965, 19009, 19045, 19061, 19146, 19299, 19440,
+  19634, 19775, 19922, 20011, 20029, 20063, 20107, 20189, 20311, 20429,
+  20681, 20799, 20917, 21003, 21047, 21163, 21339, 21503, 21727, 21891,
+  22057, 22173, 22217, 22299, 22425, 22543, 22795, 22913, 23035, 23121,
+  23165, 23275, 23441, 23597, 23829, 23989, 24153, 24263, 24307, 24389,
+  24511, 24629, 24881, 24999, 25121, 25207, 25251, 25360, 25531, 25688,
+  25920, 26087, 26258, 26373, 26417, 26499, 26621, 26739, 26991, 27109,
+  27227, 27313, 27357, 27479, 27662, 27835, 28050, 28225, 28410, 28533,
+  28578, 28660, 28786, 28908, 29160, 29278, 29400, 29486, 29530, 29646,
+  29832, 30004, 30226, 30400, 30578, 30702, 30746, 30828, 30954, 31076,
+  31328, 31450, 31572, 31658, 31702, 31819, 31990, 32153, 32371, 32536,
+  32705, 32822, 32867, 32949, 33075, 33197, 33449, 33567, 33689, 33775,
+  33819, 33935, 34121, 34293, 34515, 34689, 34867, 34991, 35035, 35117,
+  35243, 35365, 35617, 35739, 35861, 35947, 35991, 36029, 36044, 36059
+};
+
+static const uint8_t asset_mock_screen_runs[36074] = {
+  0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,
+  0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF9,0xF9,
+  0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0x09,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,
+  0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,
+  0xE0,0x01,0x03,0xB2,0x03,0xB2,0x03,0xB2,0x03,0xB2,0x03,0xB2,0x03,0xB2,0x03,0xB2,
+  0x03,0xB2,0x03,0xB2,0x03,0xB2,0x03,0xB2,0x03,0xB2,0x03,0x02,0xF8,0xF8,0xF8,0xF8,
+  0xF8,0xE0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,
+  0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,
+  0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,
+  0x02,0xA0,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0x00,0x1C,
+  0x78,0x01,0x03,0x02,0x08,0x0C,0x80,0x01,0x03,0x02,0x00,0x1C,0x78,0x01,0x03,0x02,
+  0x00,0x1C,0x78,0x01,0x03,0x02,0x0C,0x08,0x0C,0x70,0x01,0x03,0x02,0x2C,0x70,0x01,
+  0x03,0x02,0x00,0x1C,0x78,0x01,0x03,0x02,0x2C,0x70,0x01,0x03,0x02,0x00,0x1C,0x78,
+  0x01,0x03,0x02,0x00,0x24,0x70,0x01,0x03,0x02,0x08,0x0C,0x18,0x1C,0x40,0x01,0x03,
+  0x02,0x08,0x0C,0x20,0x0C,0x48,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,
+  0x03,0x02,0x0C,0x08,0x0C,0x70,0x01,0x03,0x02,0x00,0x14,0x80,0x01,0x03,0x02,0x0C,
+  0x08,0x0C,0x70,0x01,0x03,0x02,0x0C,0x08,0x0C,0x70,0x01,0x03,0x02,0x0C,0x08,0x0C,
+  0x70,0x01,0x03,0x02,0x0C,0x90,0x01,0x03,0x02,0x0C,0x08,0x0C,0x70,0x01,0x03,0x02,
+  0x18,0x0C,0x70,0x01,0x03,0x02,0x0C,0x08,0x0C,0x70,0x01,0x03,0x02,0x0C,0x08,0x0C,
+  0x70,0x01,0x03,0x02,0x00,0x14,0x10,0x0C,0x08,0x0C,0x38,0x01,0x03,0x02,0x00,0x14,
+  0x18,0x14,0x48,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0x0C,
+  0x08,0x0C,0x70,0x01,0x03,0x02,0x08,0x0C,0x80,0x01,0x03,0x02,0x18,0x0C,0x18,0x15,
+  0x38,0x01,0x03,0x02,0x18,0x0C,0x70,0x01,0x03,0x02,0x0C,0x08,0x0C,0x70,0x01,0x03,
+  0x02,0x0C,0x90,0x01,0x03,0x02,0x0C,0x90,0x01,0x03,0x02,0x18,0x0C,0x70,0x01,0x03,
+  0x02,0x0C,0x08,0x0C,0x70,0x01,0x03,0x02,0x0C,0x08,0x0C,0x70,0x01,0x03,0x02,0x08,
+  0x0C,0x10,0x0C,0x08,0x0C,0x38,0x01,0x03,0x02,0x08,0x0C,0x20,0x0C,0x48,0x01,0x03,
+  0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0x0C,0x08,0x0C,0x70,0x01,0x03,
+  0x02,0x08,0x0C,0x80,0x01,0x03,0x02,0x10,0x0C,0x78,0x01,0x03,0x02,0x08,0x14,0x78,
+  0x01,0x03,0x02,0x2C,0x70,0x01,0x03,0x02,0x24,0x78,0x01,0x03,0x02,0x24,0x78,0x01,
+  0x03,0x02,0x10,0x0C,0x78,0x01,0x03,0x02,0x00,0x1C,0x78,0x01,0x03,0x02,0x00,0x24,
+  0x70,0x01,0x03,0x02,0x08,0x0C,0x10,0x0C,0x08,0x0C,0x38,0x01,0x03,0x02,0x08,0x0C,
+  0x20,0x0C,0x48,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0x0C,
+  0x08,0x0C,0x70,0x01,0x03,0x02,0x08,0x0C,0x80,0x01,0x03,0x02,0x08,0x0C,0x80,0x01,
+  0x03,0x02,0x18,0x0C,0x70,0x01,0x03,0x02,0x18,0x0C,0x70,0x01,0x03,0x02,0x18,0x0C,
+  0x70,0x01,0x03,0x02,0x0C,0x08,0x0C,0x70,0x01,0x03,0x02,0x08,0x0C,0x80,0x01,0x03,
+  0x02,0x0C,0x08,0x0C,0x70,0x01,0x03,0x02,0x18,0x0C,0x70,0x01,0x03,0x02,0x08,0x0C,
+  0x10,0x0C,0x08,0x0C,0x38,0x01,0x03,0x02,0x08,0x0C,0x20,0x0C,0x48,0x01,0x03,0x02,
+  0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0x0C,0x08,0x0C,0x70,0x01,0x03,0x02,
+  0x08,0x0C,0x80,0x01,0x03,0x02,0x00,0x0C,0x48,0x05,0x30,0x01,0x03,0x02,0x18,0x0C,
+  0x70,0x01,0x03,0x02,0x18,0x0C,0x70,0x01,0x03,0x02,0x18,0x0C,0x40,0x05,0x20,0x01,
+  0x03,0x02,0x0C,0x08,0x0C,0x70,0x01,0x03,0x02,0x08,0x0C,0x80,0x01,0x03,0x02,0x0C,
+  0x08,0x0C,0x70,0x01,0x03,0x02,0x18,0x0C,0x70,0x01,0x03,0x02,0x08,0x0C,0x10,0x0C,
+  0x08,0x0C,0x38,0x01,0x03,0x02,0x08,0x0C,0x20,0x0C,0x48,0x01,0x03,0x02,0xF8,0xF8,
+  0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0x0C,0x08,0x0C,0x70,0x01,0x03,0x02,0x08,0x0C,
+  0x80,0x01,0x03,0x02,0x0C,0x90,0x01,0x03,0x02,0x0C,0x08,0x0C,0x70,0x01,0x03,0x02,
+  0x18,0x0C,0x70,0x01,0x03,0x02,0x0C,0x08,0x0C,0x70,0x01,0x03,0x02,0x0C,0x08,0x0C,
+  0x70,0x01,0x03,0x02,0x08,0x0C,0x80,0x01,0x03,0x02,0x0C,0x08,0x0C,0x70,0x01,0x03,
+  0x02,0x0C,0x08,0x0C,0x70,0x01,0x03,0x02,0x08,0x0C,0x10,0x0C,0x08,0x0C,0x38,0x01,
+  0x03,0x02,0x08,0x0C,0x20,0x0C,0x48,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,
+  0x01,0x03,0x02,0x00,0x1C,0x78,0x01,0x03,0x02,0x2C,0x70,0x01,0x03,0x02,0x2C,0x70,
+  0x01,0x03,0x02,0x00,0x1C,0x78,0x01,0x03,0x02,0x18,0x0C,0x70,0x01,0x03,0x02,0x00,
+  0x1C,0x28,0x05,0x00,0x05,0x30,0x01,0x03,0x02,0x00,0x1C,0x78,0x01,0x03,0x02,0x08,
+  0x0C,0x80,0x01,0x03,0x02,0x00,0x1C,0x78,0x01,0x03,0x02,0x00,0x1C,0x78,0x01,0x03,
+  0x02,0x2C,0x08,0x1C,0x40,0x01,0x03,0x02,0x2C,0x00,0x2C,0x38,0x01,0x03,0x02,0xF8,
+  0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,
+  0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x68,0x05,0x20,0x05,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,
+  0xE0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,
+  0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,
+  0x38,0x05,0x58,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0x05,
+  0x48,0x05,0x40,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0x10,0x05,0x20,0x05,0x08,0x05,0x18,0x05,0x10,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,
+  0x01,0x03,0x02,0x00,0x05,0x90,0x01,0x03,0x02,0x90,0x05,0x00,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x88,0x05,0x08,0x01,0x03,
+  0x02,0xA0,0x01,0x03,0x02,0x28,0x05,0x68,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,
+  0xE0,0x01,0x03,0x02,0x98,0x05,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,
+  0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x05,0x40,0x05,0x48,0x01,0x03,0x02,
+  0xA0,0x01,0x03,0x02,0x30,0x05,0x60,0x01,0x03,0x02,0x10,0x05,0x80,0x01,0x03,0x02,
+  0x38,0x05,0x40,0x05,0x08,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,
+  0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0x38,0x05,0x58,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0x10,0x05,0x00,0x05,0x10,0x05,0x50,0x01,0x03,0x02,0xA0,0x01,0x03,
+  0x02,0xA0,0x01,0x03,0x02,0x08,0x05,0x60,0x05,0x08,0x05,0x00,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0x40,0x05,0x20,0x05,0x20,0x01,0x03,0x02,0x38,0x05,0x28,0x05,0x20,
+  0x01,0x03,0x02,0x10,0x05,0x20,0x05,0x10,0x05,0x30,0x01,0x03,0x02,0xA0,0x01,0x03,
+  0x02,0xA0,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0x40,0x05,
+  0x38,0x05,0x08,0x01,0x03,0x02,0x70,0x05,0x20,0x01,0x03,0x02,0x30,0x05,0x60,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x00,0x05,0x90,0x01,0x03,0x02,
+  0x80,0x0D,0x08,0x01,0x03,0x02,0x05,0x98,0x01,0x03,0x02,0x40,0x0D,0x40,0x05,0x01,
+  0x03,0x02,0x08,0x05,0x40,0x05,0x18,0x05,0x10,0x01,0x03,0x02,0x08,0x05,0x58,0x0D,
+  0x18,0x01,0x03,0x02,0x38,0x05,0x40,0x0D,0x00,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,
+  0xF8,0xE0,0x01,0x03,0x02,0x08,0x05,0x18,0x05,0x20,0x05,0x10,0x05,0x10,0x01,0x03,
+  0x02,0x08,0x05,0x40,0x05,0x30,0x05,0x01,0x03,0x02,0x00,0x0D,0x10,0x05,0x00,0x05,
+  0x20,0x05,0x28,0x01,0x03,0x02,0x05,0x08,0x05,0x08,0x05,0x40,0x05,0x08,0x05,0x00,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x18,0x05,0x08,0x05,0x60,0x01,0x03,0x02,0x28,
+  0x0D,0x18,0x05,0x08,0x05,0x20,0x01,0x03,0x02,0x98,0x05,0x01,0x03,0x02,0x18,0x05,
+  0x40,0x05,0x00,0x05,0x08,0x05,0x00,0x01,0x03,0x02,0x30,0x05,0x50,0x05,0x00,0x01,
+  0x03,0x02,0x00,0x05,0x00,0x05,0x48,0x05,0x08,0x05,0x10,0x01,0x03,0x02,0x30,0x05,
+  0x00,0x05,0x50,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0x10,0x0D,0x00,0x0D,0x00,0x05,0x30,0x0D,0x08,0x01,0x03,0x02,0x18,
+  0x05,0x78,0x01,0x03,0x02,0x00,0x0D,0x80,0x05,0x01,0x03,0x02,0x05,0x98,0x01,0x03,
+  0x02,0x20,0x05,0x08,0x05,0x58,0x01,0x03,0x02,0x78,0x05,0x18,0x01,0x03,0x02,0x50,
+  0x05,0x08,0x05,0x28,0x01,0x03,0x02,0x08,0x05,0x88,0x01,0x03,0x02,0x48,0x05,0x40,
+  0x05,0x01,0x03,0x02,0x05,0x10,0x05,0x20,0x05,0x48,0x01,0x03,0x02,0x10,0x0D,0x40,
+  0x05,0x00,0x0D,0x10,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,
+  0x10,0x0D,0x00,0x05,0x30,0x05,0x18,0x05,0x00,0x01,0x03,0x02,0x0D,0x10,0x05,0x08,
+  0x05,0x00,0x0D,0x00,0x0D,0x00,0x05,0x18,0x01,0x03,0x02,0x05,0x68,0x05,0x20,0x01,
+  0x03,0x02,0x20,0x05,0x00,0x3D,0x10,0x05,0x08,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,
+  0xA0,0x01,0x03,0x02,0x05,0x08,0x0D,0x38,0x0D,0x18,0x0D,0x01,0x03,0x02,0x00,0x05,
+  0x10,0x05,0x18,0x05,0x20,0x05,0x18,0x01,0x03,0x02,0x20,0x05,0x00,0x05,0x10,0x05,
+  0x00,0x05,0x30,0x01,0x03,0x02,0x0D,0x40,0x05,0x40,0x01,0x03,0x02,0x30,0x15,0x00,
+  0x15,0x28,0x05,0x01,0x03,0x02,0x00,0x0D,0x08,0x0D,0x20,0x0D,0x00,0x05,0x18,0x05,
+  0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0x70,0x05,0x20,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x18,0x05,0x48,0x05,0x20,0x01,
+  0x03,0x02,0x00,0x05,0x90,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x00,0x05,0x10,0x05,
+  0x10,0x0D,0x48,0x01,0x03,0x02,0x08,0x05,0x88,0x01,0x03,0x02,0x00,0x05,0x70,0x05,
+  0x10,0x01,0x03,0x02,0x78,0x05,0x18,0x01,0x03,0x02,0x28,0x05,0x50,0x05,0x08,0x01,
+  0x03,0x02,0x48,0x05,0x48,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,
+  0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x80,0x05,0x10,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x28,0x05,0x68,0x01,0x03,0x02,0x38,0x05,0x08,
+  0x05,0x40,0x01,0x03,0x02,0x58,0x0D,0x10,0x05,0x10,0x01,0x03,0x02,0xA0,0x01,0x03,
+  0x02,0x18,0x05,0x00,0x05,0x68,0x01,0x03,0x02,0x20,0x05,0x60,0x05,0x00,0x01,0x03,
+  0x02,0x05,0x48,0x05,0x40,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,
+  0x02,0x20,0x05,0x70,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x08,0x05,0x88,0x01,0x03,
+  0x02,0x88,0x05,0x08,0x01,0x03,0x02,0x05,0x80,0x05,0x08,0x01,0x03,0x02,0x68,0x05,
+  0x28,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,
+  0xF8,0xE0,0x01,0x03,0x02,0x48,0x05,0x48,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x08,0x05,0x88,0x01,0x03,0x02,0xA0,0x01,0x03,
+  0x02,0xA0,0x01,0x03,0x02,0x10,0x0D,0x68,0x05,0x00,0x01,0x03,0x02,0x28,0x05,0x20,
+  0x05,0x38,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,
+  0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0x58,0x05,0x10,0x05,0x18,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0x78,0x05,0x18,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,
+  0x10,0x05,0x80,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0x20,0x05,0x70,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,
+  0xA0,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0xA0,0x01,0x03,
+  0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x98,0x05,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0x70,0x05,0x20,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,
+  0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,
+  0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x18,0x05,0x78,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,
+  0xE0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,
+  0xA0,0x01,0x03,0x02,0x90,0x05,0x00,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x80,0x05,0x10,0x01,0x03,0x02,0xA0,0x01,0x03,
+  0x02,0x20,0x05,0x50,0x0D,0x08,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,
+  0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,
+  0x02,0xA0,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x28,0x05,
+  0x40,0x05,0x18,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x30,0x05,0x60,0x01,0x03,
+  0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,
+  0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xF8,0xF8,0xF8,
+  0xF8,0xF8,0xE0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0x68,0x0D,0x20,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,
+  0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,
+  0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,
+  0x02,0xA0,0x01,0x03,0x02,0x0C,0x08,0x14,0x08,0x0C,0x48,0x01,0x03,0x02,0x0C,0x08,
+  0x14,0x08,0x0C,0x48,0x01,0x03,0x02,0x0C,0x08,0x14,0x08,0x0C,0x48,0x01,0x03,0x02,
+  0x0C,0x08,0x14,0x00,0x05,0x0C,0x15,0x30,0x01,0x03,0x02,0x0C,0x08,0x14,0x08,0x0C,
+  0x48,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x0C,0x08,0x14,0x08,0x0C,0x48,0x01,0x03,
+  0x02,0x0C,0x08,0x14,0x08,0x0C,0x48,0x01,0x03,0x02,0x0C,0x08,0x14,0x08,0x0C,0x48,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x0C,0x08,0x14,0x08,0x0C,0x48,0x01,0x03,0x02,
+  0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x14,0x00,0x0C,
+  0x08,0x04,0x58,0x01,0x03,0x02,0x14,0x00,0x0C,0x08,0x04,0x40,0x15,0x01,0x03,0x02,
+  0x14,0x00,0x0C,0x08,0x04,0x58,0x01,0x03,0x02,0x14,0x00,0x0C,0x08,0x04,0x58,0x01,
+  0x03,0x02,0x14,0x00,0x0C,0x08,0x04,0x58,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x14,
+  0x00,0x0C,0x08,0x04,0x58,0x01,0x03,0x02,0x14,0x00,0x0C,0x08,0x04,0x58,0x01,0x03,
+  0x02,0x14,0x00,0x0C,0x08,0x04,0x58,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x14,0x00,
+  0x0C,0x08,0x04,0x58,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,
+  0xA0,0x01,0x03,0x02,0x04,0x00,0x04,0x00,0x04,0x10,0x04,0x58,0x01,0x03,0x02,0x04,
+  0x00,0x04,0x00,0x04,0x10,0x04,0x58,0x01,0x03,0x02,0x04,0x00,0x04,0x00,0x04,0x10,
+  0x04,0x58,0x01,0x03,0x02,0x04,0x00,0x04,0x00,0x04,0x10,0x04,0x58,0x01,0x03,0x02,
+  0x04,0x00,0x04,0x00,0x04,0x10,0x04,0x58,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x04,
+  0x00,0x04,0x00,0x04,0x10,0x04,0x58,0x01,0x03,0x02,0x04,0x00,0x04,0x00,0x04,0x10,
+  0x04,0x58,0x01,0x03,0x02,0x04,0x00,0x04,0x00,0x04,0x10,0x04,0x58,0x01,0x03,0x02,
+  0xA0,0x01,0x03,0x02,0x04,0x00,0x04,0x00,0x04,0x10,0x04,0x58,0x01,0x03,0x02,0xF8,
+  0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x04,0x00,0x04,0x00,
+  0x14,0x08,0x0C,0x00,0x04,0x38,0x01,0x03,0x02,0x04,0x00,0x04,0x00,0x14,0x08,0x0C,
+  0x00,0x04,0x38,0x01,0x03,0x02,0x04,0x00,0x04,0x00,0x14,0x08,0x0C,0x00,0x04,0x38,
+  0x01,0x03,0x02,0x04,0x00,0x04,0x00,0x14,0x08,0x0C,0x00,0x04,0x38,0x01,0x03,0x02,
+  0x04,0x00,0x04,0x00,0x14,0x08,0x0C,0x00,0x04,0x38,0x01,0x03,0x02,0xA0,0x01,0x03,
+  0x02,0x04,0x00,0x04,0x00,0x14,0x08,0x0C,0x00,0x04,0x38,0x01,0x03,0x02,0x04,0x00,
+  0x04,0x00,0x14,0x08,0x0C,0x00,0x04,0x38,0x01,0x03,0x02,0x04,0x00,0x04,0x00,0x14,
+  0x08,0x0C,0x00,0x04,0x38,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x04,0x00,0x04,0x00,
+  0x14,0x08,0x0C,0x00,0x04,0x38,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0xA9,0x03,0x02,0xA9,0x03,
+  0x02,0xA9,0x03,0x02,0xA9,0x03,0x02,0xA9,0x03,0x02,0xA9,0x03,0x02,0xA9,0x03,0x02,
+  0xA9,0x03,0x02,0xA9,0x03,0x02,0xA9,0x03,0x02,0xA9,0x03,0x02,0xA9,0x03,0x02,0xF8,
+  0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0x03,
+  0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0xB2,0x03,0xB2,0x03,0xB2,0x03,0xB2,
+  0x03,0xB2,0x03,0xB2,0x03,0xB2,0x03,0xB2,0x03,0xB2,0x03,0xB2,0x03,0xB2,0x03,0xB2,
+  0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,
+  0xE0,0x01,0x03,0x02,0x08,0x0C,0x18,0x1C,0x40,0x01,0x03,0x02,0x08,0x0C,0x18,0x1C,
+  0x40,0x01,0x03,0x02,0x08,0x0C,0x10,0x0C,0x08,0x0C,0x38,0x01,0x03,0x02,0x08,0x0C,
+  0x10,0x2C,0x38,0x01,0x03,0x02,0x08,0x0C,0x18,0x1C,0x40,0x01,0x03,0x02,0x08,0x0C,
+  0x10,0x2C,0x38,0x01,0x03,0x02,0x08,0x0C,0x18,0x1C,0x40,0x01,0x03,0x02,0x08,0x0C,
+  0x18,0x24,0x38,0x01,0x03,0x02,0x00,0x1C,0x10,0x1C,0x40,0x01,0x03,0x02,0x00,0x1C,
+  0x18,0x0C,0x48,0x01,0x03,0x02,0x00,0x1C,0x10,0x1C,0x40,0x01,0x03,0x02,0x00,0x1C,
+  0x10,0x1C,0x40,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0x00,
+  0x14,0x10,0x0C,0x08,0x0C,0x38,0x01,0x03,0x02,0x00,0x14,0x10,0x0C,0x08,0x0C,0x38,
+  0x01,0x03,0x02,0x00,0x14,0x10,0x0C,0x08,0x0C,0x38,0x01,0x03,0x02,0x00,0x14,0x10,
+  0x0C,0x58,0x01,0x03,0x02,0x00,0x14,0x10,0x0C,0x08,0x0C,0x38,0x01,0x03,0x02,0x00,
+  0x14,0x30,0x0C,0x38,0x01,0x03,0x02,0x00,0x14,0x10,0x0C,0x08,0x0C,0x38,0x01,0x03,
+  0x02,0x00,0x14,0x10,0x0C,0x08,0x0C,0x38,0x01,0x03,0x02,0x0C,0x08,0x0C,0x00,0x0C,
+  0x08,0x0C,0x38,0x01,0x03,0x02,0x0C,0x08,0x0C,0x08,0x14,0x48,0x01,0x03,0x02,0x0C,
+  0x08,0x0C,0x00,0x0C,0x08,0x0C,0x38,0x01,0x03,0x02,0x0C,0x08,0x0C,0x00,0x0C,0x08,
+  0x0C,0x38,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0x08,0x0C,
+  0x30,0x0C,0x38,0x01,0x03,0x02,0x08,0x0C,0x30,0x0C,0x38,0x01,0x03,0x02,0x08,0x0C,
+  0x10,0x0C,0x08,0x0C,0x38,0x01,0x03,0x02,0x08,0x0C,0x10,0x0C,0x58,0x01,0x03,0x02,
+  0x08,0x0C,0x10,0x0C,0x58,0x01,0x03,0x02,0x08,0x0C,0x30,0x0C,0x38,0x01,0x03,0x02,
+  0x08,0x0C,0x10,0x0C,0x08,0x0C,0x38,0x01,0x03,0x02,0x08,0x0C,0x10,0x0C,0x08,0x0C,
+  0x38,0x01,0x03,0x02,0x18,0x0C,0x00,0x0C,0x08,0x0C,0x38,0x01,0x03,0x02,0x18,0x0C,
+  0x10,0x0C,0x48,0x01,0x03,0x02,0x18,0x0C,0x20,0x0C,0x38,0x01,0x03,0x02,0x18,0x0C,
+  0x20,0x0C,0x38,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0x08,
+  0x0C,0x28,0x0C,0x40,0x01,0x03,0x02,0x08,0x0C,0x20,0x14,0x40,0x01,0x03,0x02,0x08,
+  0x0C,0x10,0x2C,0x38,0x01,0x03,0x02,0x08,0x0C,0x10,0x24,0x40,0x01,0x03,0x02,0x08,
+  0x0C,0x10,0x24,0x40,0x01,0x03,0x02,0x08,0x0C,0x28,0x0C,0x40,0x01,0x03,0x02,0x08,
+  0x0C,0x18,0x1C,0x40,0x01,0x03,0x02,0x08,0x0C,0x18,0x24,0x38,0x01,0x03,0x02,0x10,
+  0x0C,0x08,0x0C,0x08,0x0C,0x38,0x01,0x03,0x02,0x10,0x0C,0x18,0x0C,0x48,0x01,0x03,
+  0x02,0x10,0x0C,0x20,0x0C,0x40,0x01,0x03,0x02,0x10,0x0C,0x18,0x14,0x40,0x01,0x03,
+  0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0x08,0x0C,0x20,0x0C,0x48,0x01,
+  0x03,0x02,0x08,0x0C,0x30,0x0C,0x38,0x01,0x03,0x02,0x08,0x0C,0x30,0x0C,0x38,0x01,
+  0x03,0x02,0x08,0x0C,0x30,0x0C,0x38,0x01,0x03,0x02,0x08,0x0C,0x10,0x0C,0x08,0x0C,
+  0x38,0x01,0x03,0x02,0x08,0x0C,0x20,0x0C,0x48,0x01,0x03,0x02,0x08,0x0C,0x10,0x0C,
+  0x08,0x0C,0x38,0x01,0x03,0x02,0x08,0x0C,0x30,0x0C,0x38,0x01,0x03,0x02,0x08,0x0C,
+  0x10,0x0C,0x08,0x0C,0x38,0x01,0x03,0x02,0x08,0x0C,0x20,0x0C,0x48,0x01,0x03,0x02,
+  0x08,0x0C,0x20,0x0C,0x48,0x01,0x03,0x02,0x08,0x0C,0x30,0x0C,0x38,0x01,0x03,0x02,
+  0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0x08,0x0C,0x18,0x0C,0x50,0x01,0x03,
+  0x02,0x08,0x0C,0x30,0x0C,0x38,0x01,0x03,0x02,0x08,0x0C,0x30,0x0C,0x38,0x01,0x03,
+  0x02,0x08,0x0C,0x30,0x0C,0x38,0x01,0x03,0x02,0x08,0x0C,0x10,0x0C,0x08,0x0C,0x38,
+  0x01,0x03,0x02,0x08,0x0C,0x20,0x0C,0x48,0x01,0x03,0x02,0x08,0x0C,0x10,0x0C,0x08,
+  0x0C,0x38,0x01,0x03,0x02,0x08,0x0C,0x10,0x05,0x10,0x0C,0x20,0x05,0x08,0x01,0x03,
+  0x02,0x00,0x0C,0x18,0x0C,0x08,0x0C,0x38,0x01,0x03,0x02,0x00,0x0C,0x28,0x0C,0x48,
+  0x01,0x03,0x02,0x00,0x0C,0x20,0x0C,0x50,0x01,0x03,0x02,0x00,0x0C,0x38,0x0C,0x38,
+  0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0x08,0x0C,0x10,0x0C,
+  0x58,0x01,0x03,0x02,0x08,0x0C,0x10,0x0C,0x08,0x0C,0x38,0x01,0x03,0x02,0x08,0x0C,
+  0x30,0x0C,0x38,0x01,0x03,0x02,0x08,0x0C,0x10,0x0C,0x08,0x0C,0x38,0x01,0x03,0x02,
+  0x08,0x0C,0x10,0x0C,0x08,0x0C,0x38,0x01,0x03,0x02,0x08,0x0C,0x20,0x0C,0x48,0x01,
+  0x03,0x02,0x08,0x0C,0x10,0x0C,0x08,0x0C,0x38,0x01,0x03,0x02,0x08,0x0C,0x10,0x0C,
+  0x08,0x0C,0x38,0x01,0x03,0x02,0x0C,0x20,0x0C,0x08,0x0C,0x38,0x01,0x03,0x02,0x0C,
+  0x30,0x0C,0x48,0x01,0x03,0x02,0x0C,0x20,0x0C,0x58,0x01,0x03,0x02,0x0C,0x20,0x0C,
+  0x08,0x0C,0x38,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0x2C,
+  0x00,0x2C,0x38,0x01,0x03,0x02,0x2C,0x08,0x1C,0x40,0x01,0x03,0x02,0x2C,0x20,0x0C,
+  0x38,0x01,0x03,0x02,0x2C,0x08,0x1C,0x40,0x01,0x03,0x02,0x2C,0x08,0x1C,0x40,0x01,
+  0x03,0x02,0x2C,0x10,0x0C,0x48,0x01,0x03,0x02,0x2C,0x08,0x1C,0x40,0x01,0x03,0x02,
+  0x2C,0x08,0x1C,0x08,0x05,0x28,0x01,0x03,0x02,0x2C,0x08,0x1C,0x40,0x01,0x03,0x02,
+  0x2C,0x00,0x2C,0x38,0x01,0x03,0x02,0x2C,0x00,0x2C,0x38,0x01,0x03,0x02,0x2C,0x08,
+  0x1C,0x40,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0x58,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x10,0x05,0x70,0x05,0x00,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0x18,0x05,0x10,0x05,0x28,0x05,0x10,0x0D,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0x05,0x08,0x05,0x10,0x05,0x10,0x05,0x40,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x98,0x05,0x01,0x03,0x02,
+  0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,
+  0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,
+  0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,
+  0x02,0xA0,0x01,0x03,0x02,0x48,0x05,0x18,0x05,0x20,0x01,0x03,0x02,0xA0,0x01,0x03,
+  0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x10,0x05,0x40,0x05,0x30,0x01,0x03,
+  0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0x08,0x15,0x50,0x25,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,
+  0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x05,0x10,0x05,0x78,0x01,0x03,0x02,
+  0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x08,0x0D,0x10,0x0D,0x10,0x0D,0x10,0x0D,
+  0x08,0x01,0x03,0x02,0x08,0x05,0x40,0x05,0x38,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,
+  0xF8,0xE0,0x01,0x03,0x02,0x10,0x0D,0x30,0x05,0x38,0x01,0x03,0x02,0x38,0x05,0x00,
+  0x05,0x48,0x01,0x03,0x02,0x00,0x05,0x10,0x05,0x70,0x01,0x03,0x02,0x10,0x1D,0x40,
+  0x05,0x18,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,
+  0x02,0x20,0x05,0x70,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x78,
+  0x05,0x18,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,
+  0x03,0x02,0x60,0x05,0x28,0x05,0x01,0x03,0x02,0x18,0x05,0x28,0x05,0x18,0x05,0x18,
+  0x01,0x03,0x02,0x28,0x05,0x38,0x05,0x20,0x01,0x03,0x02,0x30,0x05,0x30,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,
+  0x02,0x38,0x0D,0x10,0x05,0x30,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,
+  0x02,0xA0,0x01,0x03,0x02,0x18,0x05,0x00,0x0D,0x28,0x1D,0x10,0x01,0x03,0x02,0xF8,
+  0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0x05,0x00,0x05,0x20,0x0D,0x00,0x05,0x20,
+  0x05,0x10,0x01,0x03,0x02,0x40,0x05,0x40,0x05,0x00,0x01,0x03,0x02,0x05,0x60,0x05,
+  0x28,0x01,0x03,0x02,0x08,0x05,0x50,0x05,0x10,0x05,0x08,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0x28,0x05,0x18,0x05,0x40,0x01,0x03,0x02,0x38,0x05,
+  0x40,0x05,0x08,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0x00,
+  0x05,0x20,0x05,0x08,0x05,0x20,0x05,0x00,0x0D,0x00,0x01,0x03,0x02,0x20,0x05,0x50,
+  0x05,0x08,0x05,0x01,0x03,0x02,0x30,0x05,0x20,0x05,0x30,0x01,0x03,0x02,0x00,0x05,
+  0x28,0x0D,0x10,0x05,0x20,0x05,0x00,0x01,0x03,0x02,0xA5,0x01,0x03,0x02,0xA5,0x01,
+  0x03,0x02,0xA5,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA5,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0x00,0x05,0x90,0x01,0x03,0x02,0x20,0x05,0x10,0x05,0x50,0x01,0x03,0x02,
+  0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0x20,0x0D,0x38,0x05,0x20,0x01,0x03,
+  0x02,0x0D,0x60,0x05,0x20,0x01,0x03,0x02,0x38,0x0D,0x50,0x01,0x03,0x02,0x05,0x48,
+  0x0D,0x30,0x05,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0x68,
+  0x05,0x28,0x01,0x03,0x02,0x68,0x05,0x28,0x01,0x03,0x02,0x48,0x15,0x38,0x01,0x03,
+  0x02,0x48,0x05,0x48,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x05,
+  0x10,0x0D,0x10,0x0D,0x10,0x0D,0x10,0x0D,0x01,0x03,0x02,0x50,0x05,0x30,0x05,0x00,
+  0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,
+  0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,
+  0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,
+  0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x0D,0x38,0x05,0x40,0x05,0x01,0x03,0x02,
+  0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x08,0x05,0x18,
+  0x05,0x18,0x0D,0x30,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xF8,
+  0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,
+  0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,
+  0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x00,0x05,0x10,0x05,
+  0x10,0x05,0x10,0x05,0x30,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,
+  0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x28,0x05,0x50,
+  0x05,0x08,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,
+  0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,
+  0x02,0x08,0x05,0x68,0x0D,0x08,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,
+  0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0x58,0x05,0x38,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,
+  0x28,0x05,0x10,0x05,0x10,0x05,0x28,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x10,
+  0x05,0x80,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,
+  0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,
+  0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xF8,0xF8,0xF8,
+  0xF8,0xF8,0xE0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xF8,
+  0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,
+  0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,
+  0xA0,0x01,0x03,0x02,0x78,0x05,0x18,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0x0C,0x08,0x14,0x08,
+  0x0C,0x48,0x01,0x03,0x02,0x0C,0x08,0x14,0x08,0x0C,0x48,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0x0C,0x08,0x14,0x08,0x0C,0x48,0x01,0x03,0x02,0x0C,0x08,0x14,0x08,0x0C,
+  0x48,0x01,0x03,0x02,0x0C,0x08,0x14,0x08,0x0C,0x48,0x01,0x03,0x02,0xA0,0x01,0x03,
+  0x02,0x00,0x05,0x90,0x01,0x03,0x02,0x0C,0x08,0x14,0x08,0x0C,0x48,0x01,0x03,0x02,
+  0xA0,0x01,0x03,0x02,0x0C,0x08,0x14,0x08,0x0C,0x48,0x01,0x03,0x02,0xA0,0x01,0x03,
+  0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0x14,0x00,0x0C,0x08,0x04,0x58,
+  0x01,0x03,0x02,0x14,0x00,0x0C,0x08,0x04,0x58,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,
+  0x14,0x00,0x0C,0x08,0x04,0x58,0x01,0x03,0x02,0x14,0x00,0x0C,0x08,0x04,0x58,0x01,
+  0x03,0x02,0x14,0x00,0x0C,0x08,0x04,0x58,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x28,
+  0x05,0x68,0x01,0x03,0x02,0x14,0x00,0x0C,0x08,0x04,0x58,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0x14,0x00,0x0C,0x08,0x04,0x58,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xF8,
+  0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0x04,0x00,0x04,0x00,0x04,0x10,0x04,0x58,
+  0x01,0x03,0x02,0x04,0x00,0x04,0x00,0x04,0x10,0x04,0x58,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0x04,0x00,0x04,0x00,0x04,0x10,0x04,0x58,0x01,0x03,0x02,0x04,0x00,0x04,
+  0x00,0x04,0x10,0x04,0x58,0x01,0x03,0x02,0x04,0x00,0x04,0x00,0x04,0x10,0x04,0x58,
+  0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x04,0x00,0x04,0x00,0x04,
+  0x10,0x04,0x58,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x04,0x00,0x04,0x00,0x04,0x10,
+  0x04,0x58,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,
+  0x03,0x02,0x04,0x00,0x04,0x00,0x14,0x08,0x0C,0x00,0x04,0x38,0x01,0x03,0x02,0x04,
+  0x00,0x04,0x00,0x14,0x08,0x0C,0x00,0x04,0x38,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,
+  0x04,0x00,0x04,0x00,0x14,0x08,0x0C,0x00,0x04,0x38,0x01,0x03,0x02,0x04,0x00,0x04,
+  0x00,0x14,0x08,0x0C,0x00,0x04,0x38,0x01,0x03,0x02,0x04,0x00,0x04,0x00,0x14,0x08,
+  0x0C,0x00,0x04,0x38,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x80,0x05,0x10,0x01,0x03,
+  0x02,0x04,0x00,0x04,0x00,0x14,0x08,0x0C,0x00,0x04,0x38,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0x04,0x00,0x04,0x00,0x14,0x08,0x0C,0x00,0x04,0x38,0x01,0x03,0x02,0xA0,
+  0x01,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,
+  0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,
+  0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0x50,0x05,0x40,0x01,0x03,0x02,0xA0,0x01,
+  0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xA0,0x01,0x03,0x02,0xF8,0xF8,
+  0xF8,0xF8,0xF8,0xE0,0x01,0x03,0x02,0xA9,0x03,0x02,0xA9,0x03,0x02,0xA9,0x03,0x02,
+  0xA9,0x03,0x02,0xA9,0x03,0x02,0xA9,0x03,0x02,0xA9,0x03,0x02,0xA9,0x03,0x02,0xA9,
+  0x03,0x02,0xA9,0x03,0x02,0xA9,0x03,0x02,0xA9,0x03,0x02,0xF8,0xF8,0xF8,0xF8,0xF8,
+  0xE0,0x01,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0x03,0x02,0xF8,0xF8,0xF8,
+  0xF8,0xF8,0xE0,0xFA,0xFA,0xFA,0xFA,0xFA,0xFA,0xFA,0xFA,0xFA,0x12,0xF8,0xF8,0xF8,
+  0xF8,0xF8,0xE0,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,
+  0xF9,0xF9,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,
+  0xFB,0x02,0x03,0x08,0x9A,0x03,0xFA,0xFA,0x32,0x03,0xFA,0xFA,0x32,0x03,0xFA,0xFA,
+  0x32,0x03,0xFA,0xFA,0x32,0x03,0xFA,0xFA,0x32,0x03,0xFA,0xFA,0x32,0x03,0xA0,0x02,
+  0x03,0x01,0x03,0xA0,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,
+  0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,
+  0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0xA0,0x01,0x03,0x01,0x03,0x28,
+  0x0E,0x10,0x0E,0x10,0x0E,0x10,0x01,0x03,0x08,0x1C,0x25,0x48,0x2D,0x40,0x0D,0x90,
+  0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x10,0x0C,0x1D,0x58,0x2D,0x48,0x05,0x30,
+  0x05,0x10,0x05,0x30,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x08,0x1C,0x25,0x48,
+  0x2D,0x48,0x0D,0x88,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x08,0x1C,0xF8,0x90,
+  0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x00,0x0C,0x08,0x0C,0x15,0x50,0x25,0x50,
+  0x05,0x28,0x0D,0x10,0x05,0x30,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x00,0x2C,
+  0x0D,0x50,0x0D,0x10,0x0D,0x40,0x0D,0x90,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,
+  0x28,0x0E,0x10,0x0E,0x10,0x0E,0x10,0x01,0x03,0x01,0x03,0x20,0x16,0x10,0x0E,0x10,
+  0x0E,0x10,0x01,0x03,0x00,0x0C,0x00,0x05,0x0C,0x60,0x0D,0x78,0x05,0x80,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x08,0x14,0x05,0x08,
+  0x0D,0x18,0x05,0x00,0x05,0x10,0x0D,0x68,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x00,0x0C,0x00,0x05,0x0C,0x60,0x0D,0x68,0x05,0x90,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x00,0x0C,0x08,0x0C,0xF8,0x80,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x00,0x0C,
+  0x00,0x05,0x0C,0x08,0x0D,0x40,0x0D,0x10,0x0D,0x40,0x05,0x00,0x05,0x30,0x05,0x00,
+  0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x00,0x0C,0x00,0x0D,0x08,0x0D,0x48,0x0D,0x10,0x0D,0x40,0x05,0x00,0x05,
+  0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x20,
+  0x16,0x10,0x0E,0x10,0x0E,0x10,0x01,0x03,0x01,0x03,0x28,0x0E,0x10,0x0E,0x10,0x0E,
+  0x10,0x01,0x03,0x00,0x0C,0x00,0x05,0x0C,0x60,0x2D,0x58,0x05,0x80,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x10,0x0C,0x05,0x10,0x0D,
+  0x08,0x25,0x08,0x2D,0x58,0x05,0x30,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x18,0x05,0x0C,0x60,0x2D,
+  0x48,0x05,0x90,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x20,0x0C,0xF8,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x00,0x0C,0x00,0x05,0x0C,0x08,0x0D,0x68,0x0D,0x40,0x05,0x00,0x05,
+  0x30,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x00,0x0C,0x00,0x0D,0x10,0x0D,0x40,0x0D,0x10,0x0D,0x40,
+  0x05,0x00,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x28,0x0E,0x10,0x0E,0x10,0x0E,0x10,0x01,0x03,0x01,0x03,0x28,0x0E,0x10,
+  0x36,0x10,0x01,0x03,0x00,0x0C,0x00,0x05,0x0C,0x0D,0x18,0x25,0x08,0x0D,0x10,0x0D,
+  0x48,0x05,0x28,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x10,0x0C,0x05,0x10,0x0D,0x10,0x05,
+  0x00,0x05,0x10,0x0D,0x10,0x0D,0x48,0x05,0x30,0x05,0x08,0x05,0x00,0x05,0x20,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x18,0x0C,0x15,
+  0x18,0x25,0x08,0x0D,0x10,0x0D,0x40,0x0D,0x28,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x10,
+  0x14,0x08,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x00,0x2C,0x1D,0x08,0x25,0x20,0x15,0x50,
+  0x05,0x30,0x05,0x08,0x05,0x00,0x05,0x20,0x15,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x00,0x24,0x10,0x0D,0x08,0x25,0x08,0x35,0x40,0x05,0x00,0x05,
+  0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x15,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x28,0x0E,0x10,0x36,0x10,0x01,0x03,0x01,0x03,0x28,0x0E,
+  0x38,0x0E,0x10,0x01,0x03,0x00,0x0C,0x00,0x05,0x0C,0x60,0x0D,0x10,0x0D,0x50,0x05,
+  0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x10,
+  0x0C,0x05,0x10,0x0D,0x08,0x25,0x08,0x0D,0x10,0x0D,0x48,0x05,0x30,0x05,0x08,0x05,
+  0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x10,0x0C,0x05,0x68,0x0D,0x10,0x0D,0x40,0x05,0x00,0x05,0x80,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x20,0x0C,0xF8,0x80,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x18,0x05,0x0C,
+  0x08,0x0D,0x68,0x0D,0x40,0x05,0x00,0x05,0x30,0x05,0x00,0x05,0x00,0x05,0x20,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x18,0x05,0x0C,
+  0x08,0x0D,0x68,0x0D,0x40,0x05,0x00,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0E,0x38,0x0E,0x10,0x01,0x03,0x01,0x03,
+  0x28,0x0E,0x38,0x0E,0x10,0x01,0x03,0x00,0x0C,0x00,0x05,0x0C,0x60,0x0D,0x10,0x0D,
+  0x50,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x10,0x0C,0x05,0x10,0x0D,0x10,0x05,0x00,0x05,0x10,0x0D,0x10,0x0D,0x40,0x05,
+  0x30,0x05,0x10,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x08,0x0C,0x0D,0x68,0x0D,0x10,0x0D,0x40,0x05,0x00,0x05,
+  0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x20,
+  0x0C,0xF8,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x18,0x05,0x0C,0x08,0x0D,0x40,0x0D,0x10,0x0D,0x40,0x05,0x00,0x05,0x30,0x05,
+  0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x18,0x05,0x0C,0x08,0x0D,0x68,0x0D,0x40,0x05,0x00,0x05,0x80,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0E,0x38,
+  0x0E,0x10,0x01,0x03,0x01,0x03,0x18,0x2E,0x28,0x0E,0x10,0x01,0x03,0x00,0x0C,0x00,
+  0x05,0x0C,0x1D,0x48,0x25,0x48,0x0D,0x90,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,
+  0x10,0x0C,0x25,0x50,0x25,0x48,0x15,0x20,0x15,0x08,0x05,0x30,0x05,0x10,0x05,0x10,
+  0x05,0x18,0x01,0x03,0x00,0x0C,0x00,0x35,0x48,0x25,0x50,0x05,0x90,0x05,0x10,0x05,
+  0x10,0x05,0x18,0x01,0x03,0x00,0x0C,0x08,0x0C,0xF8,0x88,0x05,0x10,0x05,0x10,0x05,
+  0x18,0x01,0x03,0x18,0x05,0x0C,0x08,0x0D,0x48,0x25,0x50,0x05,0x28,0x0D,0x10,0x05,
+  0x28,0x05,0x00,0x05,0x08,0x05,0x10,0x05,0x18,0x01,0x03,0x00,0x0C,0x00,0x05,0x0C,
+  0x15,0x70,0x0D,0x40,0x0D,0x88,0x05,0x00,0x05,0x08,0x05,0x10,0x05,0x18,0x01,0x03,
+  0x18,0x2E,0x28,0x0E,0x10,0x01,0x03,0x01,0x03,0xA0,0x01,0x03,0x08,0x1C,0xF8,0xF8,
+  0x01,0x03,0x00,0x2C,0xF8,0xF0,0x01,0x03,0x00,0x2C,0xF8,0xF0,0x01,0x03,0x08,0x1C,
+  0xF8,0xF8,0x01,0x03,0x20,0x0C,0xF8,0xF0,0x01,0x03,0x08,0x1C,0xF8,0xF8,0x01,0x03,
+  0xA0,0x01,0x03,0x01,0x03,0x28,0x0D,0x10,0x35,0x10,0x01,0x03,0xF8,0xC0,0x05,0x10,
+  0x05,0x10,0x05,0x18,0x01,0x03,0xF8,0xC0,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,
+  0xF8,0xC0,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0xF8,0xC0,0x05,0x10,0x05,0x10,
+  0x05,0x18,0x01,0x03,0xF8,0xC0,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0xF8,0xC0,
+  0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x28,0x0D,0x10,0x35,0x10,0x01,0x03,0x01,
+  0x03,0x20,0x15,0x10,0x0D,0x38,0x01,0x03,0xF8,0xB8,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0xF8,0xB8,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0xF8,0xB8,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0xF8,0xB8,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0xF8,0xB8,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0xF8,0xB8,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x20,0x15,0x10,0x0D,0x38,0x01,0x03,0x01,
+  0x03,0x28,0x0D,0x10,0x2D,0x18,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,
+  0x10,0x2D,0x18,0x01,0x03,0x01,0x03,0x28,0x0D,0x38,0x0D,0x10,0x01,0x03,0x02,0x30,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x15,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x15,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,0x38,0x0D,0x10,0x01,
+  0x03,0x01,0x03,0x28,0x0D,0x38,0x0D,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x28,0x0D,0x38,0x0D,0x10,0x01,0x03,0x01,0x03,0x28,0x0D,0x10,0x0D,0x10,0x0D,0x10,
+  0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,0x10,0x0D,0x10,0x0D,0x10,0x01,
+  0x03,0x01,0x03,0x18,0x2D,0x08,0x25,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,
+  0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,
+  0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,
+  0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x08,0x05,0x10,0x05,
+  0x18,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x08,0x05,0x10,0x05,0x18,0x01,0x03,
+  0x18,0x2D,0x08,0x25,0x18,0x01,0x03,0x01,0x03,0xA0,0x01,0x03,0x02,0xF8,0xF8,0x20,
+  0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,
+  0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,
+  0xA0,0x01,0x03,0x01,0x03,0x28,0x0D,0x18,0x2D,0x10,0x01,0x03,0x02,0x10,0x35,0x48,
+  0x2D,0x40,0x0D,0x30,0x05,0x10,0x05,0x30,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,
+  0x02,0x10,0x25,0x50,0x35,0x40,0x15,0x28,0x05,0x10,0x05,0x30,0x0D,0x08,0x05,0x10,
+  0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,
+  0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x18,0x25,0x48,0x0D,0x10,
+  0x0D,0x48,0x05,0x28,0x0D,0x10,0x05,0x30,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,
+  0x02,0x10,0x25,0x50,0x35,0x48,0x05,0x90,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,
+  0x28,0x0D,0x18,0x2D,0x10,0x01,0x03,0x01,0x03,0x20,0x15,0x10,0x0D,0x38,0x01,0x03,
+  0x02,0x10,0x0D,0x68,0x0D,0x78,0x05,0x20,0x0D,0x08,0x05,0x00,0x05,0x20,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x08,
+  0x0D,0x48,0x0D,0x68,0x05,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,
+  0x0D,0x10,0x0D,0x40,0x0D,0x10,0x0D,0x40,0x05,0x00,0x05,0x30,0x05,0x00,0x05,0x00,
+  0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0x10,0x0D,0x08,0x0D,0x48,0x0D,0x68,0x05,0x00,0x05,0x80,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x20,0x15,0x10,0x0D,0x38,0x01,
+  0x03,0x01,0x03,0x28,0x0D,0x10,0x2D,0x18,0x01,0x03,0x02,0x10,0x0D,0x68,0x2D,0x58,
+  0x05,0x28,0x05,0x08,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x40,0x2D,0x48,0x05,0x40,
+  0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x05,0x10,
+  0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x40,0x0D,0x10,0x0D,0x40,0x05,0x00,
+  0x05,0x30,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x40,0x2D,0x48,0x05,0x00,
+  0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x28,0x0D,0x10,0x2D,0x18,0x01,0x03,0x01,0x03,0x28,0x0D,0x10,0x0D,0x10,0x0D,0x10,
+  0x01,0x03,0x02,0x10,0x25,0x18,0x25,0x08,0x0D,0x10,0x0D,0x48,0x05,0x30,0x05,0x10,
+  0x05,0x28,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0x10,0x0D,0x10,0x0D,0x08,0x25,0x30,0x0D,0x40,0x0D,0x30,0x05,0x08,0x05,0x00,
+  0x05,0x28,0x0D,0x00,0x05,0x00,0x05,0x08,0x05,0x18,0x01,0x03,0x02,0x30,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x35,0x08,
+  0x25,0x08,0x35,0x48,0x05,0x30,0x05,0x08,0x05,0x00,0x05,0x20,0x15,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x08,0x25,0x30,
+  0x0D,0x40,0x15,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x15,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,0x10,0x0D,0x10,0x0D,0x10,0x01,
+  0x03,0x01,0x03,0x28,0x0D,0x10,0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,
+  0x0D,0x10,0x0D,0x50,0x05,0x28,0x05,0x08,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x68,
+  0x0D,0x50,0x05,0x28,0x05,0x08,0x05,0x00,0x05,0x30,0x05,0x00,0x05,0x00,0x05,0x08,
+  0x05,0x18,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x68,0x0D,0x40,0x05,0x00,
+  0x05,0x30,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x68,0x0D,0x40,0x05,0x00,
+  0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x28,0x0D,0x10,0x0D,0x10,0x0D,0x10,0x01,0x03,0x01,0x03,0x28,0x0D,0x10,0x0D,0x10,
+  0x0D,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,0x0D,0x10,0x0D,0x50,0x05,0x28,0x05,0x08,
+  0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x40,0x0D,0x10,0x0D,0x50,0x05,0x20,0x05,0x10,
+  0x05,0x00,0x05,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0x10,0x0D,0x10,0x0D,0x68,0x0D,0x40,0x05,0x00,0x05,0x30,0x05,0x00,0x05,0x00,
+  0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0x10,0x0D,0x10,0x0D,0x40,0x0D,0x10,0x0D,0x40,0x05,0x00,0x05,0x80,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,0x10,0x0D,
+  0x10,0x0D,0x10,0x01,0x03,0x01,0x03,0x18,0x2D,0x08,0x25,0x18,0x01,0x03,0x02,0x10,
+  0x35,0x48,0x25,0x48,0x0D,0x28,0x15,0x08,0x05,0x30,0x05,0x10,0x05,0x10,0x05,0x18,
+  0x01,0x03,0x02,0x10,0x2D,0x50,0x25,0x48,0x0D,0x28,0x15,0x08,0x05,0x28,0x0D,0x10,
+  0x05,0x08,0x15,0x10,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,
+  0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x0D,0x10,
+  0x0D,0x68,0x0D,0x48,0x05,0x28,0x0D,0x10,0x05,0x28,0x05,0x00,0x05,0x08,0x05,0x10,
+  0x05,0x18,0x01,0x03,0x02,0x10,0x2D,0x50,0x25,0x48,0x05,0x00,0x05,0x80,0x05,0x00,
+  0x05,0x08,0x05,0x10,0x05,0x18,0x01,0x03,0x18,0x2D,0x08,0x25,0x18,0x01,0x03,0x01,
+  0x03,0xA0,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,
+  0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,
+  0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0xA0,0x01,0x03,0x01,0x03,0x28,0x0D,0x10,
+  0x35,0x10,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,
+  0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,
+  0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,
+  0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,
+  0x05,0x10,0x05,0x18,0x01,0x03,0x28,0x0D,0x10,0x35,0x10,0x01,0x03,0x01,0x03,0x20,
+  0x15,0x38,0x0D,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x20,0x15,0x38,0x0D,
+  0x10,0x01,0x03,0x01,0x03,0x28,0x0D,0x38,0x0D,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x28,0x0D,0x38,0x0D,0x10,0x01,0x03,0x01,0x03,0x28,0x0D,0x20,0x1D,0x18,
+  0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x15,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x20,0x15,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,
+  0x20,0x1D,0x18,0x01,0x03,0x01,0x03,0x28,0x0D,0x30,0x0D,0x18,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x28,0x0D,0x30,0x0D,0x18,0x01,0x03,0x01,0x03,0x28,0x0D,0x28,
+  0x0D,0x20,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,0x28,0x0D,0x20,0x01,
+  0x03,0x01,0x03,0x18,0x2D,0x18,0x0D,0x20,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,
+  0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,
+  0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,
+  0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x08,0x05,0x10,0x05,
+  0x18,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x08,0x05,0x10,0x05,0x18,0x01,0x03,
+  0x18,0x2D,0x18,0x0D,0x20,0x01,0x03,0x01,0x03,0xA0,0x01,0x03,0x02,0xF8,0xF8,0x20,
+  0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,
+  0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,
+  0xA0,0x01,0x03,0x01,0x03,0x28,0x0E,0x18,0x26,0x18,0x01,0x03,0x02,0x10,0x35,0x48,
+  0x2D,0x40,0x0D,0x90,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x18,0x25,0x50,
+  0x2D,0x48,0x05,0x90,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x25,0x50,
+  0x35,0x40,0x15,0x88,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x35,0x40,
+  0x35,0x40,0x15,0x88,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,
+  0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,
+  0x01,0x03,0x28,0x0E,0x18,0x26,0x18,0x01,0x03,0x01,0x03,0x20,0x16,0x10,0x0E,0x10,
+  0x0E,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,0x0D,0x78,0x05,0x80,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x10,
+  0x05,0x00,0x05,0x10,0x0D,0x68,0x0D,0x88,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x08,0x0D,0x48,0x0D,0x68,0x05,0x90,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,
+  0x0D,0x68,0x0D,0x78,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x20,0x16,0x10,0x0E,0x10,0x0E,0x10,0x01,0x03,0x01,
+  0x03,0x28,0x0E,0x10,0x0E,0x10,0x0E,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,0x2D,0x58,
+  0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0x10,0x0D,0x30,0x25,0x08,0x2D,0x50,0x05,0x88,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x40,0x2D,0x48,
+  0x05,0x90,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0x10,0x0D,0x68,0x2D,0x58,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0E,0x10,0x0E,0x10,0x0E,0x10,0x01,
+  0x03,0x01,0x03,0x28,0x0E,0x18,0x26,0x18,0x01,0x03,0x02,0x10,0x25,0x18,0x25,0x08,
+  0x0D,0x10,0x0D,0x48,0x05,0x28,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x00,
+  0x1D,0x10,0x05,0x00,0x05,0x10,0x0D,0x10,0x0D,0x48,0x05,0x28,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x08,0x25,0x30,0x0D,0x40,0x0D,0x28,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0x10,0x25,0x18,0x25,0x30,0x0D,0x50,0x05,0x20,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x15,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x20,0x15,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x28,0x0E,0x18,0x26,0x18,0x01,0x03,0x01,0x03,0x28,0x0E,0x10,0x0E,0x10,0x0E,0x10,
+  0x01,0x03,0x02,0x10,0x0D,0x68,0x0D,0x10,0x0D,0x50,0x05,0x80,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x08,
+  0x25,0x08,0x0D,0x10,0x0D,0x48,0x05,0x88,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x68,0x0D,0x50,0x05,0x80,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,
+  0x0D,0x90,0x0D,0x48,0x05,0x88,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0E,0x10,0x0E,0x10,0x0E,0x10,0x01,0x03,0x01,
+  0x03,0x28,0x0E,0x10,0x0E,0x10,0x0E,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,0x0D,0x10,
+  0x0D,0x50,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x10,0x05,0x00,0x05,0x10,0x0D,0x10,0x0D,0x48,
+  0x05,0x88,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0x10,0x0D,0x10,0x0D,0x40,0x0D,0x10,0x0D,0x50,0x05,0x80,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,0x0D,0x10,
+  0x0D,0x48,0x05,0x88,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x28,0x0E,0x10,0x0E,0x10,0x0E,0x10,0x01,0x03,0x01,0x03,0x18,
+  0x2E,0x08,0x26,0x18,0x01,0x03,0x02,0x10,0x35,0x48,0x25,0x48,0x0D,0x90,0x05,0x10,
+  0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x18,0x25,0x50,0x25,0x48,0x15,0x88,0x05,0x10,
+  0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x2D,0x50,0x25,0x48,0x0D,0x90,0x05,0x10,
+  0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x0D,0x70,0x25,0x50,0x05,0x90,0x05,0x10,
+  0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x08,0x05,0x10,0x05,
+  0x18,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x08,0x05,0x10,0x05,0x18,0x01,0x03,
+  0x18,0x2E,0x08,0x26,0x18,0x01,0x03,0x01,0x03,0xA0,0x01,0x03,0x02,0xF8,0xF8,0x20,
+  0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,
+  0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,
+  0xA0,0x01,0x03,0x01,0x03,0x28,0x0D,0x18,0x2D,0x10,0x01,0x03,0x02,0xF8,0xB8,0x05,
+  0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,
+  0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,
+  0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,
+  0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x28,0x0D,
+  0x18,0x2D,0x10,0x01,0x03,0x01,0x03,0x20,0x15,0x10,0x0D,0x10,0x0D,0x10,0x01,0x03,
+  0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x20,0x15,0x10,0x0D,0x10,0x0D,0x10,0x01,0x03,0x01,
+  0x03,0x28,0x0D,0x10,0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x28,0x0D,0x10,0x0D,0x10,0x0D,0x10,0x01,0x03,0x01,0x03,0x28,0x0D,0x18,0x2D,0x10,
+  0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x15,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x20,0x15,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,
+  0x18,0x2D,0x10,0x01,0x03,0x01,0x03,0x28,0x0D,0x38,0x0D,0x10,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x28,0x0D,0x38,0x0D,0x10,0x01,0x03,0x01,0x03,0x28,0x0D,0x10,
+  0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,0x10,0x0D,
+  0x10,0x0D,0x10,0x01,0x03,0x01,0x03,0x18,0x2D,0x08,0x25,0x18,0x01,0x03,0x02,0xF8,
+  0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,
+  0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,
+  0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x08,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x08,0x05,0x10,
+  0x05,0x18,0x01,0x03,0x18,0x2D,0x08,0x25,0x18,0x01,0x03,0x01,0x03,0xA0,0x01,0x03,
+  0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,
+  0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,
+  0xF8,0x20,0x01,0x03,0xA0,0x01,0x03,0x01,0x03,0x28,0x0D,0x18,0x25,0x18,0x01,0x03,
+  0x02,0x10,0x35,0x48,0x2D,0x40,0x05,0x00,0x05,0x28,0x05,0x10,0x05,0x30,0x05,0x10,
+  0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x25,0x58,0x2D,0x48,0x05,0x30,0x05,0x10,
+  0x05,0x30,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,
+  0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,
+  0x02,0x18,0x25,0x48,0x0D,0x10,0x0D,0x48,0x05,0x28,0x0D,0x10,0x05,0x30,0x05,0x10,
+  0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x25,0x50,0x35,0x40,0x0D,0x90,0x05,0x10,
+  0x05,0x10,0x05,0x18,0x01,0x03,0x28,0x0D,0x18,0x25,0x18,0x01,0x03,0x01,0x03,0x20,
+  0x15,0x10,0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,0x0D,0x68,0x05,0x00,
+  0x05,0x20,0x0D,0x08,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x08,0x0D,0x18,0x05,0x00,0x05,0x10,
+  0x0D,0x68,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,
+  0x0D,0x10,0x0D,0x40,0x0D,0x10,0x0D,0x40,0x05,0x00,0x05,0x30,0x05,0x00,0x05,0x00,
+  0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0x10,0x0D,0x08,0x0D,0x48,0x0D,0x68,0x05,0x00,0x05,0x80,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x20,0x15,0x10,0x0D,0x10,0x0D,
+  0x10,0x01,0x03,0x01,0x03,0x28,0x0D,0x10,0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0x10,
+  0x0D,0x68,0x2D,0x48,0x05,0x00,0x05,0x28,0x05,0x08,0x05,0x00,0x05,0x20,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,
+  0x0D,0x08,0x25,0x08,0x2D,0x58,0x05,0x30,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,
+  0x0D,0x10,0x0D,0x40,0x0D,0x10,0x0D,0x40,0x05,0x00,0x05,0x30,0x05,0x00,0x05,0x00,
+  0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0x10,0x0D,0x10,0x0D,0x40,0x2D,0x48,0x05,0x00,0x05,0x80,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,0x10,0x0D,0x10,0x0D,
+  0x10,0x01,0x03,0x01,0x03,0x28,0x0D,0x10,0x35,0x10,0x01,0x03,0x02,0x10,0x25,0x18,
+  0x25,0x08,0x0D,0x10,0x0D,0x40,0x15,0x28,0x05,0x10,0x05,0x28,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x10,
+  0x05,0x00,0x05,0x10,0x0D,0x10,0x0D,0x48,0x05,0x30,0x05,0x08,0x05,0x00,0x05,0x20,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,
+  0x35,0x08,0x25,0x08,0x35,0x48,0x05,0x30,0x05,0x08,0x05,0x00,0x05,0x20,0x15,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x08,
+  0x25,0x30,0x0D,0x40,0x0D,0x28,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x15,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,0x10,0x35,0x10,0x01,
+  0x03,0x01,0x03,0x28,0x0D,0x10,0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,
+  0x0D,0x10,0x0D,0x50,0x05,0x28,0x05,0x08,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x08,
+  0x25,0x08,0x0D,0x10,0x0D,0x48,0x05,0x30,0x05,0x08,0x05,0x00,0x05,0x20,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,
+  0x0D,0x10,0x0D,0x68,0x0D,0x40,0x05,0x00,0x05,0x30,0x05,0x00,0x05,0x00,0x05,0x20,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,
+  0x0D,0x10,0x0D,0x68,0x0D,0x40,0x05,0x00,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,0x10,0x0D,0x10,0x0D,0x10,0x01,
+  0x03,0x01,0x03,0x28,0x0D,0x10,0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,
+  0x0D,0x10,0x0D,0x50,0x05,0x28,0x05,0x08,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x10,
+  0x05,0x00,0x05,0x10,0x0D,0x10,0x0D,0x40,0x05,0x30,0x05,0x10,0x05,0x00,0x05,0x20,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0x10,0x0D,0x10,0x0D,0x68,0x0D,0x40,0x05,0x00,0x05,0x30,0x05,0x00,0x05,0x00,
+  0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0x10,0x0D,0x10,0x0D,0x40,0x0D,0x10,0x0D,0x40,0x05,0x00,0x05,0x80,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,0x10,0x0D,
+  0x10,0x0D,0x10,0x01,0x03,0x01,0x03,0x18,0x2D,0x00,0x0D,0x10,0x0D,0x10,0x01,0x03,
+  0x02,0x10,0x35,0x48,0x25,0x58,0x05,0x20,0x15,0x08,0x05,0x30,0x05,0x10,0x05,0x10,
+  0x05,0x18,0x01,0x03,0x02,0x10,0x2D,0x50,0x25,0x48,0x15,0x20,0x15,0x08,0x05,0x30,
+  0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,
+  0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,
+  0x0D,0x10,0x0D,0x68,0x0D,0x48,0x05,0x28,0x0D,0x10,0x05,0x28,0x05,0x00,0x05,0x08,
+  0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x2D,0x50,0x25,0x48,0x0D,0x88,0x05,0x00,
+  0x05,0x08,0x05,0x10,0x05,0x18,0x01,0x03,0x18,0x2D,0x00,0x0D,0x10,0x0D,0x10,0x01,
+  0x03,0x01,0x03,0xA0,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,
+  0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,
+  0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0xA0,0x01,0x03,0x01,0x03,0x28,
+  0x0D,0x10,0x2D,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,
+  0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,
+  0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,
+  0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,
+  0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x28,0x0D,0x10,0x2D,0x18,0x01,0x03,0x01,
+  0x03,0x20,0x15,0x10,0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x20,0x15,0x10,0x0D,0x10,0x0D,0x10,0x01,0x03,0x01,0x03,0x28,0x0D,0x10,0x0D,0x10,
+  0x0D,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,0x10,0x0D,0x10,0x0D,
+  0x10,0x01,0x03,0x01,0x03,0x28,0x0D,0x10,0x2D,0x18,0x01,0x03,0x02,0x30,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x20,0x15,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x15,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,0x10,0x2D,0x18,0x01,0x03,0x01,
+  0x03,0x28,0x0D,0x10,0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x28,0x0D,0x10,0x0D,0x10,0x0D,0x10,0x01,0x03,0x01,0x03,0x28,0x0D,0x10,0x0D,0x10,
+  0x0D,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,0x10,0x0D,0x10,0x0D,
+  0x10,0x01,0x03,0x01,0x03,0x18,0x2D,0x00,0x2D,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,
+  0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,
+  0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,
+  0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x08,0x05,
+  0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x08,0x05,0x10,0x05,0x18,
+  0x01,0x03,0x18,0x2D,0x00,0x2D,0x18,0x01,0x03,0x01,0x03,0xA0,0x01,0x03,0x02,0xF8,
+  0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,
+  0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,
+  0x01,0x03,0xA0,0x01,0x03,0x01,0x03,0x28,0x0E,0x18,0x26,0x18,0x01,0x03,0x02,0x10,
+  0x35,0x48,0x2D,0x40,0x0D,0x90,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x18,
+  0x25,0x50,0x2D,0x48,0x05,0x90,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,
+  0x35,0x48,0x2D,0x48,0x0D,0x88,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,
+  0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x18,0x25,0x50,0x25,0x50,0x05,
+  0x90,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x25,0x50,0x0D,0x10,0x0D,
+  0x40,0x0D,0x90,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x28,0x0E,0x18,0x26,0x18,
+  0x01,0x03,0x01,0x03,0x20,0x16,0x10,0x0E,0x10,0x0E,0x10,0x01,0x03,0x02,0x10,0x0D,
+  0x68,0x0D,0x78,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x10,0x05,0x00,0x05,0x10,0x0D,0x68,0x0D,
+  0x88,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0x10,0x0D,0x68,0x0D,0x68,0x05,0x90,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x40,0x0D,0x10,0x0D,0x40,
+  0x05,0x00,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0x10,0x0D,0x08,0x0D,0x48,0x0D,0x10,0x0D,0x40,0x05,0x00,0x05,0x80,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x20,0x16,
+  0x10,0x0E,0x10,0x0E,0x10,0x01,0x03,0x01,0x03,0x28,0x0E,0x10,0x0E,0x38,0x01,0x03,
+  0x02,0x10,0x0D,0x68,0x2D,0x58,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x30,0x25,0x08,0x2D,0x50,0x05,0x88,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,
+  0x0D,0x68,0x2D,0x48,0x05,0x90,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x68,0x0D,0x40,0x05,0x00,0x05,
+  0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0x10,0x0D,0x10,0x0D,0x40,0x0D,0x10,0x0D,0x40,0x05,0x00,0x05,0x80,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0E,0x10,0x0E,0x38,
+  0x01,0x03,0x01,0x03,0x28,0x0E,0x10,0x0E,0x38,0x01,0x03,0x02,0x10,0x25,0x18,0x25,
+  0x08,0x0D,0x10,0x0D,0x48,0x05,0x28,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,
+  0x00,0x1D,0x10,0x05,0x00,0x05,0x10,0x0D,0x10,0x0D,0x48,0x05,0x28,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x02,0x10,0x25,0x18,0x25,0x08,0x0D,0x10,0x0D,0x40,0x0D,0x28,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x35,
+  0x08,0x25,0x20,0x15,0x50,0x05,0x28,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x15,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,
+  0x08,0x25,0x08,0x35,0x40,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x20,0x15,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0E,0x10,
+  0x0E,0x38,0x01,0x03,0x01,0x03,0x28,0x0E,0x10,0x0E,0x38,0x01,0x03,0x02,0x10,0x0D,
+  0x68,0x0D,0x10,0x0D,0x50,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x08,0x25,0x08,0x0D,0x10,0x0D,
+  0x48,0x05,0x88,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0x10,0x0D,0x68,0x0D,0x10,0x0D,0x40,0x05,0x00,0x05,0x80,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,
+  0x0D,0x68,0x0D,0x40,0x05,0x00,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x68,0x0D,0x40,0x05,0x00,
+  0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x28,0x0E,0x10,0x0E,0x38,0x01,0x03,0x01,0x03,0x28,0x0E,0x10,0x0E,0x10,0x0E,0x10,
+  0x01,0x03,0x02,0x10,0x0D,0x68,0x0D,0x10,0x0D,0x50,0x05,0x80,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x10,
+  0x05,0x00,0x05,0x10,0x0D,0x10,0x0D,0x48,0x05,0x88,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,0x0D,0x10,0x0D,0x40,
+  0x05,0x00,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x40,0x0D,0x10,0x0D,0x40,0x05,0x00,0x05,
+  0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0x10,0x0D,0x10,0x0D,0x68,0x0D,0x40,0x05,0x00,0x05,0x80,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0E,0x10,0x0E,0x10,0x0E,0x10,
+  0x01,0x03,0x01,0x03,0x18,0x2E,0x08,0x26,0x18,0x01,0x03,0x02,0x10,0x35,0x48,0x25,
+  0x48,0x0D,0x90,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x18,0x25,0x50,0x25,
+  0x48,0x15,0x88,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x35,0x48,0x25,
+  0x50,0x05,0x90,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,
+  0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x48,0x25,0x50,0x05,0x88,
+  0x05,0x00,0x05,0x08,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x2D,0x70,0x0D,0x40,
+  0x0D,0x88,0x05,0x00,0x05,0x08,0x05,0x10,0x05,0x18,0x01,0x03,0x18,0x2E,0x08,0x26,
+  0x18,0x01,0x03,0x01,0x03,0xA0,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,
+  0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,
+  0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0xA0,0x01,0x03,0x01,
+  0x03,0x28,0x0D,0x10,0x25,0x20,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,
+  0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,
+  0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,
+  0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,
+  0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x28,0x0D,0x10,0x25,0x20,0x01,
+  0x03,0x01,0x03,0x20,0x15,0x10,0x0D,0x08,0x0D,0x18,0x01,0x03,0x02,0xF8,0xB0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x20,0x15,0x10,0x0D,0x08,0x0D,0x18,0x01,0x03,0x01,0x03,0x28,0x0D,0x10,
+  0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,0x10,0x0D,
+  0x10,0x0D,0x10,0x01,0x03,0x01,0x03,0x28,0x0D,0x10,0x0D,0x10,0x0D,0x10,0x01,0x03,
+  0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x15,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,
+  0x15,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,0x10,0x0D,
+  0x10,0x0D,0x10,0x01,0x03,0x01,0x03,0x28,0x0D,0x10,0x0D,0x10,0x0D,0x10,0x01,0x03,
+  0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,0x10,0x0D,0x10,0x0D,0x10,0x01,0x03,0x01,
+  0x03,0x28,0x0D,0x10,0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x28,0x0D,0x10,0x0D,0x10,0x0D,0x10,0x01,0x03,0x01,0x03,0x18,0x2D,0x00,0x2D,0x18,
+  0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,
+  0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,
+  0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x08,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x08,0x05,0x10,0x05,0x18,0x01,0x03,0x18,0x2D,0x00,0x2D,0x18,0x01,0x03,0x01,
+  0x03,0xA0,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,
+  0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,
+  0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0xA0,0x01,0x03,0x01,0x03,0x28,0x0D,0x10,
+  0x35,0x10,0x01,0x03,0x02,0x10,0x35,0x48,0x2D,0x40,0x05,0x00,0x05,0x28,0x05,0x10,
+  0x05,0x30,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x18,0x25,0x50,0x2D,0x48,
+  0x05,0x90,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,
+  0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x35,0x40,0x35,0x40,0x15,0x28,0x05,0x10,0x05,
+  0x30,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x18,0x25,0x48,0x0D,0x10,0x0D,
+  0x48,0x05,0x28,0x0D,0x10,0x05,0x30,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,
+  0x10,0x25,0x50,0x35,0x48,0x05,0x90,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x28,
+  0x0D,0x10,0x35,0x10,0x01,0x03,0x01,0x03,0x20,0x15,0x10,0x0D,0x38,0x01,0x03,0x02,
+  0x10,0x0D,0x68,0x0D,0x68,0x05,0x00,0x05,0x20,0x0D,0x08,0x05,0x00,0x05,0x20,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,
+  0x10,0x0D,0x10,0x05,0x00,0x05,0x10,0x0D,0x68,0x0D,0x88,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,0x0D,0x78,
+  0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x40,0x0D,0x10,
+  0x0D,0x40,0x05,0x00,0x05,0x30,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x08,0x0D,0x48,
+  0x0D,0x68,0x05,0x00,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x20,0x15,0x10,0x0D,0x38,0x01,0x03,0x01,0x03,0x28,0x0D,0x10,
+  0x0D,0x38,0x01,0x03,0x02,0x10,0x0D,0x68,0x2D,0x48,0x05,0x00,0x05,0x28,0x05,0x08,
+  0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0x10,0x0D,0x30,0x25,0x08,0x2D,0x50,0x05,0x88,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,0x2D,
+  0x58,0x05,0x30,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x40,0x0D,0x10,0x0D,
+  0x40,0x05,0x00,0x05,0x30,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x40,0x2D,
+  0x48,0x05,0x90,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x28,0x0D,0x10,0x0D,0x38,0x01,0x03,0x01,0x03,0x28,0x0D,0x10,0x25,0x20,0x01,
+  0x03,0x02,0x10,0x25,0x18,0x25,0x08,0x0D,0x10,0x0D,0x40,0x15,0x28,0x05,0x10,0x05,
+  0x28,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0x10,0x0D,0x00,0x1D,0x10,0x05,0x00,0x05,0x10,0x0D,0x10,0x0D,0x48,0x05,0x28,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x25,
+  0x18,0x25,0x30,0x0D,0x50,0x05,0x28,0x05,0x08,0x05,0x00,0x05,0x20,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x35,0x08,0x25,
+  0x08,0x35,0x48,0x05,0x30,0x05,0x08,0x05,0x00,0x05,0x20,0x15,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x08,0x25,0x30,0x0D,
+  0x40,0x05,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x15,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,0x10,0x25,0x20,0x01,0x03,0x01,0x03,
+  0x28,0x0D,0x10,0x0D,0x38,0x01,0x03,0x02,0x10,0x0D,0x68,0x0D,0x10,0x0D,0x50,0x05,
+  0x28,0x05,0x08,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x08,0x25,0x08,0x0D,0x10,0x0D,
+  0x48,0x05,0x88,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0x10,0x0D,0x90,0x0D,0x48,0x05,0x30,0x05,0x08,0x05,0x00,0x05,0x20,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,
+  0x0D,0x10,0x0D,0x68,0x0D,0x40,0x05,0x00,0x05,0x30,0x05,0x00,0x05,0x00,0x05,0x20,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,
+  0x0D,0x10,0x0D,0x68,0x0D,0x40,0x05,0x90,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,0x10,0x0D,0x38,0x01,0x03,0x01,0x03,0x28,
+  0x0D,0x10,0x0D,0x38,0x01,0x03,0x02,0x10,0x0D,0x68,0x0D,0x10,0x0D,0x50,0x05,0x28,
+  0x05,0x08,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x10,0x05,0x00,0x05,0x10,0x0D,0x10,
+  0x0D,0x48,0x05,0x88,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x02,0x10,0x0D,0x68,0x0D,0x10,0x0D,0x48,0x05,0x28,0x05,0x10,0x05,
+  0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0x10,0x0D,0x10,0x0D,0x68,0x0D,0x40,0x05,0x00,0x05,0x30,0x05,0x00,0x05,
+  0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0x10,0x0D,0x10,0x0D,0x40,0x0D,0x10,0x0D,0x40,0x05,0x00,0x05,0x80,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,0x10,
+  0x0D,0x38,0x01,0x03,0x01,0x03,0x18,0x2D,0x00,0x35,0x10,0x01,0x03,0x02,0x10,0x35,
+  0x48,0x25,0x58,0x05,0x20,0x15,0x08,0x05,0x30,0x05,0x10,0x05,0x10,0x05,0x18,0x01,
+  0x03,0x02,0x18,0x25,0x50,0x25,0x48,0x15,0x88,0x05,0x10,0x05,0x10,0x05,0x18,0x01,
+  0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x0D,0x70,
+  0x25,0x50,0x05,0x28,0x15,0x08,0x05,0x30,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,
+  0x02,0x10,0x0D,0x10,0x0D,0x68,0x0D,0x48,0x05,0x28,0x0D,0x10,0x05,0x28,0x05,0x00,
+  0x05,0x08,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x2D,0x50,0x25,0x50,0x05,0x88,
+  0x05,0x00,0x05,0x08,0x05,0x10,0x05,0x18,0x01,0x03,0x18,0x2D,0x00,0x35,0x10,0x01,
+  0x03,0x01,0x03,0xA0,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,
+  0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,
+  0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0xA0,0x01,0x03,0x01,0x03,0x28,
+  0x0D,0x10,0x35,0x10,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,
+  0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,
+  0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,
+  0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,
+  0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x28,0x0D,0x10,0x35,0x10,0x01,0x03,0x01,
+  0x03,0x20,0x15,0x10,0x0D,0x38,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x20,0x15,
+  0x10,0x0D,0x38,0x01,0x03,0x01,0x03,0x28,0x0D,0x10,0x0D,0x38,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x28,0x0D,0x10,0x0D,0x38,0x01,0x03,0x01,0x03,0x28,0x0D,0x10,
+  0x25,0x20,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x15,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x20,0x15,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x28,0x0D,0x10,0x25,0x20,0x01,0x03,0x01,0x03,0x28,0x0D,0x10,0x0D,0x38,0x01,0x03,
+  0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,0x10,0x0D,0x38,0x01,0x03,0x01,0x03,0x28,
+  0x0D,0x10,0x0D,0x38,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,0x10,0x0D,
+  0x38,0x01,0x03,0x01,0x03,0x18,0x2D,0x00,0x0D,0x38,0x01,0x03,0x02,0xF8,0xB8,0x05,
+  0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,
+  0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,
+  0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x08,0x05,
+  0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x08,0x05,0x10,0x05,0x18,
+  0x01,0x03,0x18,0x2D,0x00,0x0D,0x38,0x01,0x03,0x01,0x03,0xA0,0x01,0x03,0x02,0xF8,
+  0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,
+  0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,
+  0x01,0x03,0xA0,0x01,0x03,0x01,0x03,0xA0,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,
+  0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,
+  0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0xA0,0x01,
+  0x03,0x1B,0x99,0x03,0x02,0xF9,0xF9,0x29,0x03,0x02,0xF9,0xF9,0x29,0x03,0x02,0xF9,
+  0xF9,0x29,0x03,0x02,0xF9,0xF9,0x29,0x03,0x02,0xF9,0xF9,0x29,0x03,0x02,0xF9,0xF9,
+  0x29,0x13,0x89,0x00,0x09,0xE3,0xB8,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,
+  0xFB,0xFB,0xFB,0xFB,0x53,0x2B,0x24,0x13,0x24,0x4B,0x35,0x48,0x2D,0x00,0x3B,0x04,
+  0x03,0x04,0x8B,0x04,0x13,0x04,0x13,0x04,0x4B,0x24,0x5B,0x2C,0x4B,0x04,0x33,0x04,
+  0x13,0x04,0x33,0x04,0x13,0x04,0x13,0x04,0x4B,0x24,0x53,0x34,0x43,0x14,0x8B,0x04,
+  0x13,0x04,0x13,0x04,0xFB,0xF3,0x04,0x13,0x04,0x13,0x04,0x53,0x24,0x53,0x24,0x53,
+  0x04,0x93,0x04,0x13,0x04,0x13,0x04,0x4B,0x24,0x53,0x0C,0x13,0x0C,0x4B,0x04,0x93,
+  0x04,0x13,0x04,0x13,0x04,0x4B,0x24,0x13,0x24,0x2B,0x23,0x0C,0x13,0x0C,0x03,0x0C,
+  0x13,0x0C,0x43,0x0D,0x68,0x0D,0x28,0x3B,0x04,0x03,0x04,0x83,0x04,0x03,0x04,0x03,
+  0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x43,0x0C,0x0B,0x0C,0x1B,0x04,0x03,0x04,0x13,
+  0x0C,0x6B,0x04,0x03,0x04,0x23,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x23,0x04,0x03,
+  0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x43,0x0C,0x0B,0x0C,0x4B,0x0C,0x6B,
+  0x04,0x93,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0xFB,0xE3,0x04,
+  0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x43,0x0C,0x13,0x0C,0x43,0x0C,
+  0x13,0x0C,0x43,0x04,0x03,0x04,0x83,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,
+  0x03,0x04,0x43,0x0C,0x0B,0x0C,0x4B,0x0C,0x13,0x0C,0x43,0x04,0x03,0x04,0x83,0x04,
+  0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x3B,0x0C,0x13,0x0C,0x03,0x0C,
+  0x13,0x0C,0x23,0x43,0x0C,0x0B,0x0C,0x13,0x0C,0x43,0x0D,0x68,0x2D,0x08,0x3B,0x04,
+  0x03,0x04,0x83,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x43,0x0C,
+  0x13,0x0C,0x0B,0x24,0x0B,0x2C,0x5B,0x04,0x33,0x04,0x03,0x04,0x03,0x04,0x23,0x04,
+  0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x43,0x0C,0x13,0x0C,0x43,0x2C,
+  0x4B,0x04,0x93,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0xFB,0xE3,
+  0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x43,0x0C,0x13,0x0C,0x6B,
+  0x0C,0x43,0x04,0x03,0x04,0x83,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,
+  0x04,0x43,0x0C,0x13,0x0C,0x43,0x0C,0x13,0x0C,0x43,0x04,0x03,0x04,0x83,0x04,0x03,
+  0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x5B,0x0C,0x0B,0x0C,0x13,0x0C,0x23,
+  0x3B,0x0C,0x13,0x0C,0x13,0x0C,0x43,0x25,0x18,0x25,0x08,0x0D,0x10,0x0D,0x00,0x3B,
+  0x14,0x23,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x23,0x04,0x03,0x04,0x03,0x04,0x03,
+  0x04,0x03,0x04,0x03,0x04,0x43,0x0C,0x13,0x0C,0x13,0x04,0x03,0x04,0x13,0x0C,0x13,
+  0x0C,0x4B,0x04,0x33,0x04,0x0B,0x04,0x03,0x04,0x23,0x04,0x03,0x04,0x03,0x04,0x03,
+  0x04,0x03,0x04,0x03,0x04,0x43,0x0C,0x13,0x0C,0x0B,0x24,0x33,0x0C,0x43,0x0C,0x2B,
+  0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x23,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,
+  0x04,0x03,0x04,0x63,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,
+  0x04,0x03,0x04,0xA3,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x23,0x04,0x03,0x04,0x03,
+  0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x43,0x34,0x0B,0x24,0x23,0x14,0x53,0x04,0x2B,
+  0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x23,0x14,0x03,0x04,0x03,0x04,0x0B,0x04,0x4B,
+  0x0C,0x13,0x0C,0x0B,0x24,0x0B,0x34,0x43,0x14,0x23,0x04,0x03,0x04,0x03,0x04,0x03,
+  0x04,0x23,0x14,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x53,0x0C,0x13,0x0C,0x13,
+  0x0C,0x23,0x33,0x0C,0x1B,0x0C,0x13,0x0C,0x43,0x0D,0x68,0x0D,0x10,0x0D,0x00,0x4B,
+  0x04,0x83,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x43,0x0C,0x13,
+  0x0C,0x0B,0x24,0x0B,0x0C,0x13,0x0C,0x4B,0x04,0x33,0x04,0x0B,0x04,0x03,0x04,0x23,
+  0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x43,0x0C,0x13,0x0C,0x6B,
+  0x0C,0x53,0x04,0x83,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0xFB,
+  0xE3,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x43,0x0C,0x13,0x0C,
+  0x6B,0x0C,0x43,0x04,0x03,0x04,0x83,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,
+  0x03,0x04,0x43,0x0C,0x13,0x0C,0x6B,0x0C,0x43,0x04,0x03,0x04,0x83,0x04,0x03,0x04,
+  0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x4B,0x0C,0x1B,0x0C,0x13,0x0C,0x23,0x2B,
+  0x0C,0x23,0x0C,0x13,0x0C,0x43,0x0D,0x68,0x0D,0x10,0x0D,0x00,0x4B,0x04,0x83,0x04,
+  0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x43,0x0C,0x13,0x0C,0x13,0x04,
+  0x03,0x04,0x13,0x0C,0x13,0x0C,0x43,0x04,0x33,0x04,0x13,0x04,0x03,0x04,0x23,0x04,
+  0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x43,0x0C,0x13,0x0C,0x43,0x0C,
+  0x13,0x0C,0x53,0x04,0x83,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,
+  0xFB,0xE3,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x43,0x0C,0x13,
+  0x0C,0x43,0x0C,0x13,0x0C,0x43,0x04,0x03,0x04,0x83,0x04,0x03,0x04,0x03,0x04,0x03,
+  0x04,0x03,0x04,0x03,0x04,0x43,0x0C,0x13,0x0C,0x6B,0x0C,0x43,0x04,0x03,0x04,0x83,
+  0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x03,0x04,0x43,0x0C,0x23,0x0C,0x13,
+  0x0C,0x23,0x23,0x34,0x0B,0x24,0x4B,0x35,0x48,0x25,0x08,0x4B,0x04,0x8B,0x04,0x13,
+  0x04,0x13,0x04,0x4B,0x2C,0x53,0x24,0x4B,0x14,0x23,0x14,0x0B,0x04,0x33,0x04,0x13,
+  0x04,0x13,0x04,0x4B,0x2C,0x53,0x24,0x4B,0x0C,0x93,0x04,0x13,0x04,0x13,0x04,0xFB,
+  0xF3,0x04,0x13,0x04,0x13,0x04,0x4B,0x0C,0x13,0x0C,0x4B,0x24,0x53,0x04,0x8B,0x04,
+  0x03,0x04,0x0B,0x04,0x13,0x04,0x4B,0x2C,0x73,0x0C,0x43,0x04,0x03,0x04,0x83,0x04,
+  0x03,0x04,0x0B,0x04,0x13,0x04,0x43,0x34,0x0B,0x24,0x2B,0xE3,0xB8,0xFB,0xFB,0xFB,
+  0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0x3B,0x00,0x0B,0x02,0x03,0x08,
+  0x9A,0x03,0xFA,0xFA,0x32,0x03,0xFA,0xFA,0x32,0x03,0xFA,0xFA,0x32,0x03,0xFA,0xFA,
+  0x32,0x03,0xFA,0xFA,0x32,0x03,0xFA,0xFA,0x32,0x03,0x08,0x8A,0x00,0x02,0x03,0x01,
+  0x03,0xA0,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,
+  0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,
+  0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0xA0,0x01,0x03,0x01,0x03,0x18,0x25,0x20,
+  0x0D,0x20,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,
+  0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,
+  0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,
+  0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,
+  0x05,0x10,0x05,0x18,0x01,0x03,0x18,0x25,0x20,0x0D,0x20,0x01,0x03,0x01,0x03,0x10,
+  0x0D,0x10,0x0D,0x10,0x15,0x20,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x10,0x0D,
+  0x10,0x0D,0x10,0x15,0x20,0x01,0x03,0x01,0x03,0x30,0x0D,0x20,0x0D,0x20,0x01,0x03,
+  0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x30,0x0D,0x20,0x0D,0x20,0x01,0x03,0x01,0x03,0x28,
+  0x0D,0x28,0x0D,0x20,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,
+  0x15,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x20,0x15,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x28,0x0D,0x28,0x0D,0x20,0x01,0x03,0x01,0x03,0x20,0x0D,0x30,0x0D,0x20,
+  0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x20,0x0D,0x30,0x0D,0x20,0x01,0x03,0x01,
+  0x03,0x18,0x0D,0x38,0x0D,0x20,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x18,0x0D,
+  0x38,0x0D,0x20,0x01,0x03,0x01,0x03,0x10,0x35,0x08,0x2D,0x10,0x01,0x03,0x02,0xF8,
+  0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,
+  0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,
+  0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x08,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x08,0x05,0x10,
+  0x05,0x18,0x01,0x03,0x10,0x35,0x08,0x2D,0x10,0x01,0x03,0x01,0x03,0xA0,0x01,0x03,
+  0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,
+  0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,
+  0xF8,0x20,0x01,0x03,0xA0,0x01,0x03,0x01,0x03,0x18,0x25,0x10,0x25,0x18,0x01,0x03,
+  0x02,0x10,0x35,0x48,0x2D,0x40,0x05,0x00,0x05,0x28,0x05,0x10,0x05,0x30,0x05,0x10,
+  0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x18,0x25,0x50,0x2D,0x48,0x05,0x90,0x05,0x10,
+  0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,
+  0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x18,0x25,0x48,
+  0x0D,0x10,0x0D,0x48,0x05,0x28,0x0D,0x10,0x05,0x30,0x05,0x10,0x05,0x10,0x05,0x18,
+  0x01,0x03,0x02,0x10,0x25,0x50,0x0D,0x10,0x0D,0x40,0x15,0x88,0x05,0x10,0x05,0x10,
+  0x05,0x18,0x01,0x03,0x18,0x25,0x10,0x25,0x18,0x01,0x03,0x01,0x03,0x10,0x0D,0x10,
+  0x0D,0x00,0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,0x0D,0x68,0x05,0x00,
+  0x05,0x20,0x0D,0x08,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x10,0x05,0x00,0x05,0x10,
+  0x0D,0x68,0x0D,0x88,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x40,0x0D,0x10,0x0D,0x40,0x05,0x00,
+  0x05,0x30,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x08,0x0D,0x48,0x0D,0x10,0x0D,0x40,
+  0x05,0x90,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x10,0x0D,0x10,0x0D,0x00,0x0D,0x10,0x0D,0x10,0x01,0x03,0x01,0x03,0x30,0x0D,0x28,
+  0x0D,0x18,0x01,0x03,0x02,0x10,0x0D,0x68,0x2D,0x48,0x05,0x00,0x05,0x28,0x05,0x08,
+  0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0x10,0x0D,0x30,0x25,0x08,0x2D,0x50,0x05,0x88,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,
+  0x0D,0x40,0x0D,0x10,0x0D,0x40,0x05,0x00,0x05,0x30,0x05,0x00,0x05,0x00,0x05,0x20,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,
+  0x0D,0x10,0x0D,0x40,0x0D,0x10,0x0D,0x40,0x05,0x90,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x30,0x0D,0x28,0x0D,0x18,0x01,0x03,0x01,
+  0x03,0x28,0x0D,0x28,0x0D,0x20,0x01,0x03,0x02,0x10,0x25,0x18,0x25,0x08,0x0D,0x10,
+  0x0D,0x40,0x15,0x28,0x05,0x10,0x05,0x28,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x00,0x1D,0x10,0x05,0x00,0x05,0x10,
+  0x0D,0x10,0x0D,0x48,0x05,0x28,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x35,0x08,
+  0x25,0x08,0x35,0x48,0x05,0x30,0x05,0x08,0x05,0x00,0x05,0x20,0x15,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x08,0x25,0x08,
+  0x35,0x40,0x0D,0x28,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x15,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,0x28,0x0D,0x20,0x01,0x03,0x01,
+  0x03,0x20,0x0D,0x28,0x0D,0x28,0x01,0x03,0x02,0x10,0x0D,0x68,0x0D,0x10,0x0D,0x50,
+  0x05,0x28,0x05,0x08,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x08,0x25,0x08,0x0D,0x10,
+  0x0D,0x48,0x05,0x88,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x68,0x0D,0x40,0x05,0x00,0x05,0x30,
+  0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x68,0x0D,0x40,0x05,0x90,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x20,0x0D,0x28,0x0D,
+  0x28,0x01,0x03,0x01,0x03,0x18,0x0D,0x28,0x0D,0x30,0x01,0x03,0x02,0x10,0x0D,0x68,
+  0x0D,0x10,0x0D,0x50,0x05,0x28,0x05,0x08,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x10,
+  0x05,0x00,0x05,0x10,0x0D,0x10,0x0D,0x48,0x05,0x88,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x68,
+  0x0D,0x40,0x05,0x00,0x05,0x30,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x68,
+  0x0D,0x40,0x05,0x90,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x18,0x0D,0x28,0x0D,0x30,0x01,0x03,0x01,0x03,0x10,0x35,0x00,0x35,0x10,
+  0x01,0x03,0x02,0x10,0x35,0x48,0x25,0x58,0x05,0x20,0x15,0x08,0x05,0x30,0x05,0x10,
+  0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x18,0x25,0x50,0x25,0x48,0x15,0x88,0x05,0x10,
+  0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,
+  0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x0D,0x10,
+  0x0D,0x68,0x0D,0x48,0x05,0x28,0x0D,0x10,0x05,0x28,0x05,0x00,0x05,0x08,0x05,0x10,
+  0x05,0x18,0x01,0x03,0x02,0x10,0x2D,0x70,0x0D,0x40,0x05,0x90,0x05,0x00,0x05,0x08,
+  0x05,0x10,0x05,0x18,0x01,0x03,0x10,0x35,0x00,0x35,0x10,0x01,0x03,0x01,0x03,0xA0,
+  0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,
+  0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,
+  0x02,0xF8,0xF8,0x20,0x01,0x03,0xA0,0x01,0x03,0x01,0x03,0x18,0x25,0x10,0x25,0x18,
+  0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,
+  0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,
+  0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,
+  0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,
+  0x05,0x18,0x01,0x03,0x18,0x25,0x10,0x25,0x18,0x01,0x03,0x01,0x03,0x10,0x0D,0x10,
+  0x0D,0x00,0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x10,0x0D,
+  0x10,0x0D,0x00,0x0D,0x10,0x0D,0x10,0x01,0x03,0x01,0x03,0x30,0x0D,0x30,0x0D,0x10,
+  0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x30,0x0D,0x30,0x0D,0x10,0x01,0x03,0x01,
+  0x03,0x28,0x0D,0x28,0x15,0x18,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x20,0x15,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x15,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x28,0x0D,0x28,0x15,0x18,0x01,0x03,0x01,0x03,0x20,0x0D,0x40,
+  0x0D,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x20,0x0D,0x40,0x0D,0x10,0x01,
+  0x03,0x01,0x03,0x18,0x0D,0x20,0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x18,0x0D,0x20,0x0D,0x10,0x0D,0x10,0x01,0x03,0x01,0x03,0x10,0x35,0x08,
+  0x25,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,
+  0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,
+  0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,
+  0x02,0xF8,0xB0,0x05,0x00,0x05,0x08,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x08,0x05,0x10,0x05,0x18,0x01,0x03,0x10,0x35,0x08,0x25,0x18,0x01,
+  0x03,0x01,0x03,0xA0,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,
+  0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,
+  0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0xA0,0x01,0x03,0x01,0x03,0x18,
+  0x26,0x08,0x0E,0x10,0x0E,0x10,0x01,0x03,0x02,0x10,0x35,0x48,0x2D,0x40,0x0D,0x90,
+  0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x25,0x58,0x2D,0x48,0x05,0x30,
+  0x05,0x10,0x05,0x30,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x35,0x48,
+  0x2D,0x48,0x0D,0x88,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,
+  0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,
+  0x01,0x03,0x02,0x10,0x25,0x50,0x35,0x40,0x0D,0x90,0x05,0x10,0x05,0x10,0x05,0x18,
+  0x01,0x03,0x18,0x26,0x08,0x0E,0x10,0x0E,0x10,0x01,0x03,0x01,0x03,0x10,0x0E,0x10,
+  0x0E,0x00,0x0E,0x10,0x0E,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,0x0D,0x78,0x05,0x80,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,
+  0x0D,0x08,0x0D,0x18,0x05,0x00,0x05,0x10,0x0D,0x68,0x05,0x00,0x05,0x20,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,0x0D,0x68,0x05,0x90,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x08,
+  0x0D,0x48,0x0D,0x68,0x05,0x00,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x10,0x0E,0x10,0x0E,0x00,0x0E,0x10,0x0E,0x10,0x01,
+  0x03,0x01,0x03,0x30,0x0E,0x08,0x0E,0x10,0x0E,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,
+  0x2D,0x58,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x08,0x25,0x08,0x2D,0x58,0x05,0x30,0x05,0x00,
+  0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0x10,0x0D,0x68,0x2D,0x48,0x05,0x90,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x40,
+  0x2D,0x48,0x05,0x00,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x30,0x0E,0x08,0x0E,0x10,0x0E,0x10,0x01,0x03,0x01,0x03,0x28,
+  0x0E,0x10,0x36,0x10,0x01,0x03,0x02,0x10,0x25,0x18,0x25,0x08,0x0D,0x10,0x0D,0x48,
+  0x05,0x28,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x10,0x05,0x00,
+  0x05,0x10,0x0D,0x10,0x0D,0x48,0x05,0x30,0x05,0x08,0x05,0x00,0x05,0x20,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x25,0x18,
+  0x25,0x08,0x0D,0x10,0x0D,0x40,0x0D,0x28,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,
+  0x15,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,
+  0x0D,0x08,0x25,0x30,0x0D,0x40,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x20,0x15,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0E,
+  0x10,0x36,0x10,0x01,0x03,0x01,0x03,0x20,0x0E,0x40,0x0E,0x10,0x01,0x03,0x02,0x10,
+  0x0D,0x68,0x0D,0x10,0x0D,0x50,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x08,0x25,0x08,0x0D,0x10,
+  0x0D,0x48,0x05,0x30,0x05,0x08,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,0x0D,0x10,0x0D,0x40,
+  0x05,0x00,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x68,0x0D,0x40,0x05,0x00,0x05,0x80,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x20,0x0E,
+  0x40,0x0E,0x10,0x01,0x03,0x01,0x03,0x18,0x0E,0x48,0x0E,0x10,0x01,0x03,0x02,0x10,
+  0x0D,0x68,0x0D,0x10,0x0D,0x50,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x10,0x05,0x00,0x05,0x10,
+  0x0D,0x10,0x0D,0x40,0x05,0x30,0x05,0x10,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,0x0D,0x10,
+  0x0D,0x40,0x05,0x00,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x40,0x0D,0x10,0x0D,0x40,
+  0x05,0x00,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x18,0x0E,0x48,0x0E,0x10,0x01,0x03,0x01,0x03,0x10,0x36,0x28,0x0E,0x10,
+  0x01,0x03,0x02,0x10,0x35,0x48,0x25,0x48,0x0D,0x90,0x05,0x10,0x05,0x10,0x05,0x18,
+  0x01,0x03,0x02,0x10,0x2D,0x50,0x25,0x48,0x15,0x20,0x15,0x08,0x05,0x30,0x05,0x10,
+  0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x35,0x48,0x25,0x50,0x05,0x90,0x05,0x10,
+  0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,
+  0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x08,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,
+  0x2D,0x50,0x25,0x48,0x0D,0x88,0x05,0x00,0x05,0x08,0x05,0x10,0x05,0x18,0x01,0x03,
+  0x10,0x36,0x28,0x0E,0x10,0x01,0x03,0x01,0x03,0xA0,0x01,0x03,0x02,0xF8,0xF8,0x20,
+  0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,
+  0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,
+  0xA0,0x01,0x03,0x01,0x03,0x18,0x25,0x08,0x35,0x10,0x01,0x03,0x02,0xF8,0xB8,0x05,
+  0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,
+  0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,
+  0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,
+  0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x18,0x25,
+  0x08,0x35,0x10,0x01,0x03,0x01,0x03,0x10,0x0D,0x10,0x0D,0x00,0x0D,0x38,0x01,0x03,
+  0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x10,0x0D,0x10,0x0D,0x00,0x0D,0x38,0x01,0x03,0x01,
+  0x03,0x30,0x0D,0x08,0x2D,0x18,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x30,0x0D,
+  0x08,0x2D,0x18,0x01,0x03,0x01,0x03,0x28,0x0D,0x38,0x0D,0x10,0x01,0x03,0x02,0x30,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x15,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x15,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,0x38,0x0D,0x10,0x01,
+  0x03,0x01,0x03,0x20,0x0D,0x40,0x0D,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x20,0x0D,0x40,0x0D,0x10,0x01,0x03,0x01,0x03,0x18,0x0D,0x20,0x0D,0x10,0x0D,0x10,
+  0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x18,0x0D,0x20,0x0D,0x10,0x0D,0x10,0x01,
+  0x03,0x01,0x03,0x10,0x35,0x08,0x25,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,
+  0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,
+  0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,
+  0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x08,0x05,0x10,0x05,
+  0x18,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x08,0x05,0x10,0x05,0x18,0x01,0x03,
+  0x10,0x35,0x08,0x25,0x18,0x01,0x03,0x01,0x03,0xA0,0x01,0x03,0x02,0xF8,0xF8,0x20,
+  0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,
+  0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,
+  0xA0,0x01,0x03,0x01,0x03,0x18,0x25,0x10,0x2D,0x10,0x01,0x03,0x02,0x10,0x35,0x48,
+  0x2D,0x40,0x0D,0x30,0x05,0x10,0x05,0x30,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,
+  0x02,0x18,0x25,0x50,0x2D,0x48,0x05,0x30,0x05,0x10,0x05,0x30,0x05,0x10,0x05,0x10,
+  0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,
+  0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x18,0x25,0x50,0x25,0x50,
+  0x05,0x30,0x05,0x10,0x05,0x30,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,
+  0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x18,0x25,0x10,0x2D,0x10,0x01,0x03,
+  0x01,0x03,0x10,0x0D,0x10,0x0D,0x00,0x0D,0x38,0x01,0x03,0x02,0x10,0x0D,0x68,0x0D,
+  0x78,0x05,0x20,0x0D,0x08,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x10,0x05,0x00,0x05,
+  0x10,0x0D,0x68,0x0D,0x28,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,
+  0x10,0x0D,0x40,0x0D,0x10,0x0D,0x40,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x10,0x0D,0x10,0x0D,0x00,0x0D,0x38,0x01,0x03,0x01,0x03,0x30,0x0D,0x08,
+  0x2D,0x18,0x01,0x03,0x02,0x10,0x0D,0x68,0x2D,0x58,0x05,0x28,0x05,0x08,0x05,0x00,
+  0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0x10,0x0D,0x30,0x25,0x08,0x2D,0x50,0x05,0x38,0x05,0x00,0x05,0x00,0x05,0x20,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0x10,0x0D,0x10,0x0D,0x68,0x0D,0x40,0x05,0x00,0x05,0x30,0x05,0x00,0x05,0x00,
+  0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x30,0x0D,0x08,0x2D,0x18,0x01,0x03,0x01,0x03,0x28,0x0D,0x10,0x0D,0x10,0x0D,
+  0x10,0x01,0x03,0x02,0x10,0x25,0x18,0x25,0x08,0x0D,0x10,0x0D,0x48,0x05,0x30,0x05,
+  0x10,0x05,0x28,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0x10,0x0D,0x00,0x1D,0x10,0x05,0x00,0x05,0x10,0x0D,0x10,0x0D,0x48,0x05,
+  0x30,0x05,0x08,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x35,0x08,0x25,0x20,0x15,0x50,0x05,0x30,0x05,
+  0x08,0x05,0x00,0x05,0x20,0x15,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x15,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,0x10,0x0D,0x10,0x0D,0x10,0x01,0x03,
+  0x01,0x03,0x20,0x0D,0x18,0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,0x0D,
+  0x10,0x0D,0x50,0x05,0x28,0x05,0x08,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x08,0x25,
+  0x08,0x0D,0x10,0x0D,0x48,0x05,0x30,0x05,0x08,0x05,0x00,0x05,0x20,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,
+  0x10,0x0D,0x68,0x0D,0x40,0x05,0x00,0x05,0x28,0x05,0x08,0x05,0x00,0x05,0x20,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x20,0x0D,
+  0x18,0x0D,0x10,0x0D,0x10,0x01,0x03,0x01,0x03,0x18,0x0D,0x20,0x0D,0x10,0x0D,0x10,
+  0x01,0x03,0x02,0x10,0x0D,0x68,0x0D,0x10,0x0D,0x50,0x05,0x28,0x05,0x08,0x05,0x00,
+  0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0x10,0x0D,0x10,0x0D,0x10,0x05,0x00,0x05,0x10,0x0D,0x10,0x0D,0x48,0x05,0x28,
+  0x05,0x10,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x40,0x0D,0x10,0x0D,0x40,
+  0x05,0x00,0x05,0x20,0x05,0x10,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x18,0x0D,0x20,0x0D,0x10,0x0D,0x10,
+  0x01,0x03,0x01,0x03,0x10,0x35,0x08,0x25,0x18,0x01,0x03,0x02,0x10,0x35,0x48,0x25,
+  0x48,0x0D,0x28,0x15,0x08,0x05,0x30,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,
+  0x18,0x25,0x50,0x25,0x48,0x15,0x20,0x15,0x08,0x05,0x30,0x05,0x10,0x05,0x10,0x05,
+  0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,
+  0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x48,0x25,
+  0x50,0x05,0x28,0x15,0x08,0x05,0x28,0x05,0x00,0x05,0x08,0x05,0x10,0x05,0x18,0x01,
+  0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x08,0x05,0x10,0x05,0x18,0x01,0x03,0x10,0x35,
+  0x08,0x25,0x18,0x01,0x03,0x01,0x03,0xA0,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,
+  0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,
+  0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0xA0,0x01,
+  0x03,0x01,0x03,0x18,0x25,0x08,0x35,0x10,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,
+  0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,
+  0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,
+  0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,
+  0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x18,0x25,0x08,0x35,
+  0x10,0x01,0x03,0x01,0x03,0x10,0x0D,0x10,0x0D,0x28,0x0D,0x10,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x10,0x0D,0x10,0x0D,0x28,0x0D,0x10,0x01,0x03,0x01,0x03,0x30,
+  0x0D,0x30,0x0D,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x30,0x0D,0x30,0x0D,
+  0x10,0x01,0x03,0x01,0x03,0x28,0x0D,0x20,0x1D,0x18,0x01,0x03,0x02,0x30,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x20,0x15,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x15,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,0x20,0x1D,0x18,0x01,0x03,0x01,
+  0x03,0x20,0x0D,0x38,0x0D,0x18,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x20,0x0D,
+  0x38,0x0D,0x18,0x01,0x03,0x01,0x03,0x18,0x0D,0x38,0x0D,0x20,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x18,0x0D,0x38,0x0D,0x20,0x01,0x03,0x01,0x03,0x10,0x35,0x18,
+  0x0D,0x20,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,
+  0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,
+  0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,
+  0x02,0xF8,0xB0,0x05,0x00,0x05,0x08,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x08,0x05,0x10,0x05,0x18,0x01,0x03,0x10,0x35,0x18,0x0D,0x20,0x01,
+  0x03,0x01,0x03,0xA0,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,
+  0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,
+  0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0xA0,0x01,0x03,0x01,0x03,0x18,
+  0x26,0x10,0x26,0x18,0x01,0x03,0x02,0x10,0x35,0x48,0x2D,0x40,0x05,0x00,0x05,0x88,
+  0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x18,0x25,0x50,0x2D,0x48,0x05,0x90,
+  0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x25,0x50,0x35,0x40,0x15,0x88,
+  0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x35,0x40,0x35,0x40,0x15,0x88,
+  0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x07,0x26,0x4F,0x0E,0x17,0x0E,
+  0x4F,0x06,0x2F,0x0E,0x17,0x06,0x37,0x06,0x17,0x06,0x17,0x06,0x0F,0x08,0x01,0x03,
+  0x02,0x10,0x25,0x50,0x35,0x48,0x05,0x90,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,
+  0x18,0x26,0x10,0x26,0x18,0x01,0x03,0x01,0x03,0x10,0x0E,0x10,0x0E,0x00,0x0E,0x10,
+  0x0E,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,0x0D,0x68,0x05,0x00,0x05,0x80,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,
+  0x0D,0x10,0x05,0x00,0x05,0x10,0x0D,0x68,0x0D,0x88,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x08,0x0D,0x48,0x0D,0x68,
+  0x05,0x90,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0x10,0x0D,0x68,0x0D,0x78,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0E,0x17,0x0E,0x47,0x0E,0x17,0x0E,0x47,
+  0x06,0x07,0x06,0x37,0x06,0x07,0x06,0x07,0x06,0x27,0x06,0x07,0x06,0x07,0x06,0x07,
+  0x06,0x07,0x06,0x07,0x06,0x07,0x08,0x01,0x03,0x02,0x10,0x0D,0x08,0x0D,0x48,0x0D,
+  0x68,0x05,0x00,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x10,0x0E,0x10,0x0E,0x00,0x0E,0x10,0x0E,0x10,0x01,0x03,0x01,0x03,
+  0x30,0x0E,0x08,0x0E,0x10,0x0E,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,0x2D,0x48,0x05,
+  0x00,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0x10,0x0D,0x30,0x25,0x08,0x2D,0x50,0x05,0x88,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x40,0x2D,
+  0x48,0x05,0x90,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0x10,0x0D,0x68,0x2D,0x58,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0E,0x17,0x0E,0x47,0x0E,0x17,0x0E,
+  0x47,0x06,0x07,0x06,0x37,0x06,0x07,0x06,0x07,0x06,0x27,0x06,0x07,0x06,0x07,0x06,
+  0x07,0x06,0x07,0x06,0x07,0x06,0x07,0x08,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x40,
+  0x2D,0x48,0x05,0x90,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x30,0x0E,0x08,0x0E,0x10,0x0E,0x10,0x01,0x03,0x01,0x03,0x28,0x0E,0x18,
+  0x26,0x18,0x01,0x03,0x02,0x10,0x25,0x18,0x25,0x08,0x0D,0x10,0x0D,0x40,0x15,0x20,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x00,0x1D,0x10,0x05,0x00,0x05,0x10,
+  0x0D,0x10,0x0D,0x48,0x05,0x28,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,
+  0x0D,0x08,0x25,0x30,0x0D,0x40,0x0D,0x28,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,
+  0x25,0x18,0x25,0x30,0x0D,0x50,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,
+  0x36,0x0F,0x26,0x0F,0x36,0x4F,0x06,0x37,0x06,0x0F,0x06,0x07,0x06,0x27,0x16,0x07,
+  0x06,0x07,0x06,0x07,0x06,0x07,0x06,0x07,0x08,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,
+  0x08,0x25,0x30,0x0D,0x40,0x05,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x15,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0E,0x18,0x26,0x18,
+  0x01,0x03,0x01,0x03,0x20,0x0E,0x18,0x0E,0x10,0x0E,0x10,0x01,0x03,0x02,0x10,0x0D,
+  0x68,0x0D,0x10,0x0D,0x50,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x08,0x25,0x08,0x0D,0x10,0x0D,
+  0x48,0x05,0x88,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0x10,0x0D,0x10,0x0D,0x68,0x0D,0x50,0x05,0x80,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x90,0x0D,0x48,0x05,
+  0x88,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0x10,0x0E,0x17,0x0E,0x6F,0x0E,0x47,0x06,0x07,0x06,0x37,0x06,0x07,0x06,0x07,0x06,
+  0x27,0x06,0x07,0x06,0x07,0x06,0x07,0x06,0x07,0x06,0x07,0x06,0x07,0x08,0x01,0x03,
+  0x02,0x10,0x0D,0x10,0x0D,0x68,0x0D,0x40,0x05,0x90,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x20,0x0E,0x18,0x0E,0x10,0x0E,0x10,0x01,
+  0x03,0x01,0x03,0x18,0x0E,0x20,0x0E,0x10,0x0E,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,
+  0x0D,0x10,0x0D,0x50,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x10,0x05,0x00,0x05,0x10,0x0D,0x10,
+  0x0D,0x48,0x05,0x88,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x40,0x0D,0x10,0x0D,0x50,0x05,0x80,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,
+  0x0D,0x10,0x0D,0x48,0x05,0x88,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0x10,0x0E,0x17,0x0E,0x6F,0x0E,0x47,0x06,0x07,0x06,0x37,
+  0x06,0x07,0x06,0x07,0x06,0x27,0x06,0x07,0x06,0x07,0x06,0x07,0x06,0x07,0x06,0x07,
+  0x06,0x07,0x08,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x40,0x0D,0x10,0x0D,0x40,0x05,
+  0x00,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x18,0x0E,0x20,0x0E,0x10,0x0E,0x10,0x01,0x03,0x01,0x03,0x10,0x36,0x08,0x26,
+  0x18,0x01,0x03,0x02,0x10,0x35,0x48,0x25,0x58,0x05,0x88,0x05,0x10,0x05,0x10,0x05,
+  0x18,0x01,0x03,0x02,0x18,0x25,0x50,0x25,0x48,0x15,0x88,0x05,0x10,0x05,0x10,0x05,
+  0x18,0x01,0x03,0x02,0x10,0x2D,0x50,0x25,0x48,0x0D,0x90,0x05,0x10,0x05,0x10,0x05,
+  0x18,0x01,0x03,0x02,0x10,0x0D,0x70,0x25,0x50,0x05,0x90,0x05,0x10,0x05,0x10,0x05,
+  0x18,0x01,0x03,0x02,0x10,0x0E,0x17,0x0E,0x6F,0x0E,0x4F,0x06,0x2F,0x0E,0x17,0x06,
+  0x2F,0x06,0x07,0x06,0x0F,0x06,0x17,0x06,0x0F,0x08,0x01,0x03,0x02,0x10,0x2D,0x50,
+  0x25,0x50,0x05,0x88,0x05,0x00,0x05,0x08,0x05,0x10,0x05,0x18,0x01,0x03,0x10,0x36,
+  0x08,0x26,0x18,0x01,0x03,0x01,0x03,0xA0,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,
+  0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,
+  0x01,0x03,0x02,0x10,0xFF,0xFF,0x08,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0xA0,
+  0x01,0x03,0x01,0x03,0x18,0x25,0x10,0x2D,0x10,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,
+  0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,
+  0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,
+  0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,
+  0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x18,0x25,0x10,
+  0x2D,0x10,0x01,0x03,0x01,0x03,0x10,0x0D,0x10,0x0D,0x00,0x0D,0x10,0x0D,0x10,0x01,
+  0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x10,0x0D,0x10,0x0D,0x00,0x0D,0x10,0x0D,0x10,
+  0x01,0x03,0x01,0x03,0x30,0x0D,0x08,0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x30,0x0D,0x08,0x0D,0x10,0x0D,0x10,0x01,0x03,0x01,0x03,0x28,0x0D,
+  0x18,0x2D,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x15,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x20,0x15,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x28,0x0D,0x18,0x2D,0x10,0x01,0x03,0x01,0x03,0x20,0x0D,0x40,0x0D,0x10,0x01,
+  0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x20,0x0D,0x40,0x0D,0x10,0x01,0x03,0x01,0x03,
+  0x18,0x0D,0x20,0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x18,
+  0x0D,0x20,0x0D,0x10,0x0D,0x10,0x01,0x03,0x01,0x03,0x10,0x35,0x08,0x25,0x18,0x01,
+  0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,
+  0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,
+  0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x08,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x08,0x05,0x10,0x05,0x18,0x01,0x03,0x10,0x35,0x08,0x25,0x18,0x01,0x03,0x01,0x03,
+  0xA0,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,
+  0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,
+  0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0xA0,0x01,0x03,0x01,0x03,0x18,0x25,0x10,0x25,
+  0x18,0x01,0x03,0x02,0x10,0x35,0x48,0x2D,0x40,0x0D,0x30,0x05,0x10,0x05,0x30,0x05,
+  0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x25,0x58,0x2D,0x48,0x05,0x30,0x05,
+  0x10,0x05,0x30,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,
+  0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,
+  0x03,0x02,0x18,0x25,0x50,0x25,0x50,0x05,0x30,0x05,0x10,0x05,0x30,0x05,0x10,0x05,
+  0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x25,0x50,0x0D,0x10,0x0D,0x40,0x15,0x88,0x05,
+  0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x18,0x25,0x10,0x25,0x18,0x01,0x03,0x01,0x03,
+  0x10,0x0D,0x10,0x0D,0x00,0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,0x0D,
+  0x78,0x05,0x20,0x0D,0x08,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x08,0x0D,0x18,0x05,0x00,0x05,
+  0x10,0x0D,0x68,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0x10,0x0D,0x10,0x0D,0x40,0x0D,0x10,0x0D,0x40,0x05,0x00,0x05,0x20,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x02,0x10,0x0D,0x08,0x0D,0x48,0x0D,0x10,0x0D,0x40,0x05,0x90,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x10,0x0D,0x10,
+  0x0D,0x00,0x0D,0x10,0x0D,0x10,0x01,0x03,0x01,0x03,0x30,0x0D,0x08,0x0D,0x10,0x0D,
+  0x10,0x01,0x03,0x02,0x10,0x0D,0x68,0x2D,0x58,0x05,0x28,0x05,0x08,0x05,0x00,0x05,
+  0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0x10,0x0D,0x10,0x0D,0x08,0x25,0x08,0x2D,0x58,0x05,0x30,0x05,0x00,0x05,0x00,0x05,
+  0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0x10,0x0D,0x10,0x0D,0x68,0x0D,0x40,0x05,0x00,0x05,0x30,0x05,0x00,0x05,
+  0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0x10,0x0D,0x10,0x0D,0x40,0x0D,0x10,0x0D,0x40,0x05,0x90,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x30,0x0D,0x08,0x0D,0x10,
+  0x0D,0x10,0x01,0x03,0x01,0x03,0x28,0x0D,0x10,0x35,0x10,0x01,0x03,0x02,0x10,0x25,
+  0x18,0x25,0x08,0x0D,0x10,0x0D,0x48,0x05,0x30,0x05,0x10,0x05,0x28,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,
+  0x10,0x05,0x00,0x05,0x10,0x0D,0x10,0x0D,0x48,0x05,0x30,0x05,0x08,0x05,0x00,0x05,
+  0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0x10,0x35,0x08,0x25,0x20,0x15,0x50,0x05,0x30,0x05,0x08,0x05,0x00,0x05,0x20,0x15,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,
+  0x08,0x25,0x08,0x35,0x40,0x0D,0x28,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x15,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,0x10,0x35,0x10,
+  0x01,0x03,0x01,0x03,0x20,0x0D,0x18,0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0x10,0x0D,
+  0x68,0x0D,0x10,0x0D,0x50,0x05,0x28,0x05,0x08,0x05,0x00,0x05,0x20,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,
+  0x08,0x25,0x08,0x0D,0x10,0x0D,0x48,0x05,0x30,0x05,0x08,0x05,0x00,0x05,0x20,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0x10,0x0D,0x10,0x0D,0x68,0x0D,0x40,0x05,0x00,0x05,0x28,0x05,0x08,0x05,0x00,0x05,
+  0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0x10,0x0D,0x10,0x0D,0x68,0x0D,0x40,0x05,0x90,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x20,0x0D,0x18,0x0D,0x10,0x0D,0x10,0x01,0x03,
+  0x01,0x03,0x18,0x0D,0x20,0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,0x0D,
+  0x10,0x0D,0x50,0x05,0x28,0x05,0x08,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x10,0x05,
+  0x00,0x05,0x10,0x0D,0x10,0x0D,0x40,0x05,0x30,0x05,0x10,0x05,0x00,0x05,0x20,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0x10,0x0D,0x10,0x0D,0x40,0x0D,0x10,0x0D,0x40,0x05,0x00,0x05,0x20,0x05,0x10,0x05,
+  0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0x10,0x0D,0x10,0x0D,0x68,0x0D,0x40,0x05,0x90,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x18,0x0D,0x20,0x0D,0x10,0x0D,0x10,
+  0x01,0x03,0x01,0x03,0x10,0x35,0x00,0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0x10,0x35,
+  0x48,0x25,0x48,0x0D,0x28,0x15,0x08,0x05,0x30,0x05,0x10,0x05,0x10,0x05,0x18,0x01,
+  0x03,0x02,0x10,0x2D,0x50,0x25,0x48,0x15,0x20,0x15,0x08,0x05,0x30,0x05,0x10,0x05,
+  0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,
+  0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,
+  0x48,0x25,0x50,0x05,0x28,0x15,0x08,0x05,0x28,0x05,0x00,0x05,0x08,0x05,0x10,0x05,
+  0x18,0x01,0x03,0x02,0x10,0x2D,0x70,0x0D,0x40,0x15,0x80,0x05,0x00,0x05,0x08,0x05,
+  0x10,0x05,0x18,0x01,0x03,0x10,0x35,0x00,0x0D,0x10,0x0D,0x10,0x01,0x03,0x01,0x03,
+  0xA0,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,
+  0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,
+  0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0xA0,0x01,0x03,0x01,0x03,0x18,0x25,0x08,0x2D,
+  0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,
+  0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,
+  0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,
+  0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,
+  0x10,0x05,0x18,0x01,0x03,0x18,0x25,0x08,0x2D,0x18,0x01,0x03,0x01,0x03,0x10,0x0D,
+  0x10,0x0D,0x00,0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x10,
+  0x0D,0x10,0x0D,0x00,0x0D,0x10,0x0D,0x10,0x01,0x03,0x01,0x03,0x30,0x0D,0x08,0x0D,
+  0x10,0x0D,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x30,0x0D,0x08,0x0D,0x10,
+  0x0D,0x10,0x01,0x03,0x01,0x03,0x28,0x0D,0x10,0x2D,0x18,0x01,0x03,0x02,0x30,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x15,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x15,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,0x10,0x2D,0x18,0x01,0x03,
+  0x01,0x03,0x20,0x0D,0x18,0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x20,0x0D,0x18,0x0D,0x10,0x0D,0x10,0x01,0x03,0x01,0x03,0x18,0x0D,0x20,0x0D,
+  0x10,0x0D,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x18,0x0D,0x20,0x0D,0x10,
+  0x0D,0x10,0x01,0x03,0x01,0x03,0x10,0x35,0x00,0x2D,0x18,0x01,0x03,0x02,0xF8,0xB8,
+  0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,
+  0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,
+  0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x08,
+  0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x08,0x05,0x10,0x05,
+  0x18,0x01,0x03,0x10,0x35,0x00,0x2D,0x18,0x01,0x03,0x01,0x03,0xA0,0x01,0x03,0x02,
+  0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,
+  0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,
+  0x20,0x01,0x03,0xA0,0x01,0x03,0x01,0x03,0x18,0x26,0x10,0x26,0x18,0x01,0x03,0x02,
+  0x10,0x35,0x48,0x2D,0x40,0x05,0x00,0x05,0x88,0x05,0x10,0x05,0x10,0x05,0x18,0x01,
+  0x03,0x02,0x10,0x2D,0x50,0x2D,0x48,0x05,0x90,0x05,0x10,0x05,0x10,0x05,0x18,0x01,
+  0x03,0x02,0x10,0x35,0x48,0x2D,0x48,0x0D,0x88,0x05,0x10,0x05,0x10,0x05,0x18,0x01,
+  0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x18,0x25,0x48,
+  0x0D,0x10,0x0D,0x48,0x05,0x28,0x0D,0x10,0x05,0x30,0x05,0x10,0x05,0x10,0x05,0x18,
+  0x01,0x03,0x02,0x10,0x25,0x50,0x0D,0x10,0x0D,0x40,0x15,0x88,0x05,0x10,0x05,0x10,
+  0x05,0x18,0x01,0x03,0x18,0x26,0x10,0x26,0x18,0x01,0x03,0x01,0x03,0x10,0x0E,0x10,
+  0x0E,0x00,0x0E,0x10,0x0E,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,0x0D,0x68,0x05,0x00,
+  0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0x10,0x0D,0x10,0x0D,0x40,0x0D,0x68,0x0D,0x88,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,0x0D,0x68,0x05,0x90,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0x10,0x0D,0x10,0x0D,0x40,0x0D,0x10,0x0D,0x40,0x05,0x00,0x05,0x30,0x05,0x00,0x05,
+  0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0x10,0x0D,0x08,0x0D,0x48,0x0D,0x10,0x0D,0x40,0x05,0x90,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x10,0x0E,0x10,0x0E,0x00,
+  0x0E,0x10,0x0E,0x10,0x01,0x03,0x01,0x03,0x30,0x0E,0x08,0x0E,0x38,0x01,0x03,0x02,
+  0x10,0x0D,0x68,0x2D,0x48,0x05,0x00,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x40,0x2D,0x50,0x05,
+  0x88,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0x10,0x0D,0x68,0x2D,0x48,0x05,0x90,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x40,0x0D,0x10,0x0D,0x40,
+  0x05,0x00,0x05,0x30,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x40,0x0D,0x10,
+  0x0D,0x40,0x05,0x90,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x30,0x0E,0x08,0x0E,0x38,0x01,0x03,0x01,0x03,0x28,0x0E,0x10,0x0E,0x38,
+  0x01,0x03,0x02,0x10,0x25,0x18,0x25,0x08,0x0D,0x10,0x0D,0x40,0x15,0x20,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0x10,0x2D,0x10,0x25,0x08,0x0D,0x10,0x0D,0x48,0x05,0x28,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x25,0x18,0x25,0x08,0x0D,0x10,0x0D,0x40,
+  0x0D,0x28,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0x10,0x35,0x08,0x25,0x08,0x35,0x48,0x05,0x30,0x05,0x08,0x05,0x00,0x05,0x20,
+  0x15,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,
+  0x0D,0x08,0x25,0x08,0x35,0x40,0x0D,0x28,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,
+  0x15,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0E,0x10,0x0E,
+  0x38,0x01,0x03,0x01,0x03,0x20,0x0E,0x18,0x0E,0x38,0x01,0x03,0x02,0x10,0x0D,0x68,
+  0x0D,0x10,0x0D,0x50,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x40,0x0D,0x10,0x0D,0x48,0x05,0x88,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,
+  0x0D,0x68,0x0D,0x10,0x0D,0x40,0x05,0x00,0x05,0x80,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x68,0x0D,
+  0x40,0x05,0x00,0x05,0x30,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x68,0x0D,
+  0x40,0x05,0x90,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x20,0x0E,0x18,0x0E,0x38,0x01,0x03,0x01,0x03,0x18,0x0E,0x20,0x0E,0x10,0x0E,
+  0x10,0x01,0x03,0x02,0x10,0x0D,0x68,0x0D,0x10,0x0D,0x50,0x05,0x80,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,
+  0x40,0x0D,0x10,0x0D,0x48,0x05,0x88,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,0x0D,0x10,0x0D,0x40,0x05,0x00,0x05,
+  0x80,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0x10,0x0D,0x10,0x0D,0x68,0x0D,0x40,0x05,0x00,0x05,0x30,0x05,0x00,0x05,0x00,
+  0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0x10,0x0D,0x10,0x0D,0x68,0x0D,0x40,0x05,0x90,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x18,0x0E,0x20,0x0E,0x10,0x0E,0x10,0x01,
+  0x03,0x01,0x03,0x10,0x36,0x08,0x26,0x18,0x01,0x03,0x02,0x10,0x35,0x48,0x25,0x58,
+  0x05,0x88,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x2D,0x50,0x25,0x48,
+  0x15,0x88,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x35,0x48,0x25,0x50,
+  0x05,0x90,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,
+  0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x68,0x0D,0x48,0x05,0x28,0x0D,
+  0x10,0x05,0x28,0x05,0x00,0x05,0x08,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x2D,
+  0x70,0x0D,0x40,0x05,0x90,0x05,0x00,0x05,0x08,0x05,0x10,0x05,0x18,0x01,0x03,0x10,
+  0x36,0x08,0x26,0x18,0x01,0x03,0x01,0x03,0xA0,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,
+  0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,
+  0x20,0x01,0x03,0x02,0x10,0xFF,0xFF,0x08,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,
+  0xA0,0x01,0x03,0x01,0x03,0x18,0x25,0x10,0x2D,0x10,0x01,0x03,0x02,0xF8,0xB8,0x05,
+  0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,
+  0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,
+  0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,
+  0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x18,0x25,
+  0x10,0x2D,0x10,0x01,0x03,0x01,0x03,0x10,0x0D,0x10,0x0D,0x00,0x0D,0x10,0x0D,0x10,
+  0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x10,0x0D,0x10,0x0D,0x00,0x0D,0x10,0x0D,
+  0x10,0x01,0x03,0x01,0x03,0x30,0x0D,0x08,0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x30,0x0D,0x08,0x0D,0x10,0x0D,0x10,0x01,0x03,0x01,0x03,0x28,
+  0x0D,0x18,0x2D,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,
+  0x15,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x20,0x15,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x28,0x0D,0x18,0x2D,0x10,0x01,0x03,0x01,0x03,0x20,0x0D,0x40,0x0D,0x10,
+  0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x20,0x0D,0x40,0x0D,0x10,0x01,0x03,0x01,
+  0x03,0x18,0x0D,0x20,0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x18,0x0D,0x20,0x0D,0x10,0x0D,0x10,0x01,0x03,0x01,0x03,0x10,0x35,0x08,0x25,0x18,
+  0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,
+  0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,
+  0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x08,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x08,0x05,0x10,0x05,0x18,0x01,0x03,0x10,0x35,0x08,0x25,0x18,0x01,0x03,0x01,
+  0x03,0xA0,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,
+  0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,
+  0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0xA0,0x01,0x03,0x01,0x03,0x18,0x25,0x10,
+  0x25,0x18,0x01,0x03,0x02,0x10,0x35,0x48,0x2D,0x40,0x0D,0x30,0x05,0x10,0x05,0x30,
+  0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x25,0x58,0x2D,0x48,0x05,0x30,
+  0x05,0x10,0x05,0x30,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,
+  0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,
+  0x01,0x03,0x02,0x18,0x25,0x50,0x25,0x50,0x05,0x30,0x05,0x10,0x05,0x30,0x05,0x10,
+  0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x25,0x50,0x0D,0x10,0x0D,0x40,0x15,0x88,
+  0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x18,0x25,0x10,0x25,0x18,0x01,0x03,0x01,
+  0x03,0x10,0x0D,0x10,0x0D,0x00,0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,
+  0x0D,0x78,0x05,0x20,0x0D,0x08,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x08,0x0D,0x18,0x05,0x00,
+  0x05,0x10,0x0D,0x68,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0x10,0x0D,0x10,0x0D,0x40,0x0D,0x10,0x0D,0x40,0x05,0x00,0x05,0x20,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x08,0x0D,0x48,0x0D,0x10,0x0D,0x40,0x05,0x90,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x10,0x0D,
+  0x10,0x0D,0x00,0x0D,0x10,0x0D,0x10,0x01,0x03,0x01,0x03,0x30,0x0D,0x08,0x0D,0x10,
+  0x0D,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,0x2D,0x58,0x05,0x28,0x05,0x08,0x05,0x00,
+  0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0x10,0x0D,0x10,0x0D,0x08,0x25,0x08,0x2D,0x58,0x05,0x30,0x05,0x00,0x05,0x00,
+  0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x68,0x0D,0x40,0x05,0x00,0x05,0x30,0x05,0x00,
+  0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x40,0x0D,0x10,0x0D,0x40,0x05,0x90,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x30,0x0D,0x08,0x0D,
+  0x10,0x0D,0x10,0x01,0x03,0x01,0x03,0x28,0x0D,0x10,0x35,0x10,0x01,0x03,0x02,0x10,
+  0x25,0x18,0x25,0x08,0x0D,0x10,0x0D,0x48,0x05,0x30,0x05,0x10,0x05,0x28,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,
+  0x0D,0x10,0x05,0x00,0x05,0x10,0x0D,0x10,0x0D,0x48,0x05,0x30,0x05,0x08,0x05,0x00,
+  0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0x10,0x35,0x08,0x25,0x20,0x15,0x50,0x05,0x30,0x05,0x08,0x05,0x00,0x05,0x20,
+  0x15,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,
+  0x0D,0x08,0x25,0x08,0x35,0x40,0x0D,0x28,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,
+  0x15,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,0x10,0x35,
+  0x10,0x01,0x03,0x01,0x03,0x20,0x0D,0x18,0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0x10,
+  0x0D,0x68,0x0D,0x10,0x0D,0x50,0x05,0x28,0x05,0x08,0x05,0x00,0x05,0x20,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,
+  0x0D,0x08,0x25,0x08,0x0D,0x10,0x0D,0x48,0x05,0x30,0x05,0x08,0x05,0x00,0x05,0x20,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0x10,0x0D,0x10,0x0D,0x68,0x0D,0x40,0x05,0x00,0x05,0x28,0x05,0x08,0x05,0x00,
+  0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0x10,0x0D,0x10,0x0D,0x68,0x0D,0x40,0x05,0x90,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x20,0x0D,0x18,0x0D,0x10,0x0D,0x10,0x01,
+  0x03,0x01,0x03,0x18,0x0D,0x20,0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0x10,0x0D,0x68,
+  0x0D,0x10,0x0D,0x50,0x05,0x28,0x05,0x08,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x10,
+  0x05,0x00,0x05,0x10,0x0D,0x10,0x0D,0x40,0x05,0x30,0x05,0x10,0x05,0x00,0x05,0x20,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0x10,0x0D,0x10,0x0D,0x40,0x0D,0x10,0x0D,0x40,0x05,0x00,0x05,0x20,0x05,0x10,
+  0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x02,0x10,0x0D,0x10,0x0D,0x68,0x0D,0x40,0x05,0x90,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x18,0x0D,0x20,0x0D,0x10,0x0D,
+  0x10,0x01,0x03,0x01,0x03,0x10,0x35,0x00,0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0x10,
+  0x35,0x48,0x25,0x48,0x0D,0x28,0x15,0x08,0x05,0x30,0x05,0x10,0x05,0x10,0x05,0x18,
+  0x01,0x03,0x02,0x10,0x2D,0x50,0x25,0x48,0x15,0x20,0x15,0x08,0x05,0x30,0x05,0x10,
+  0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,
+  0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0x10,0x0D,0x10,
+  0x0D,0x48,0x25,0x50,0x05,0x28,0x15,0x08,0x05,0x28,0x05,0x00,0x05,0x08,0x05,0x10,
+  0x05,0x18,0x01,0x03,0x02,0x10,0x2D,0x70,0x0D,0x40,0x15,0x80,0x05,0x00,0x05,0x08,
+  0x05,0x10,0x05,0x18,0x01,0x03,0x10,0x35,0x00,0x0D,0x10,0x0D,0x10,0x01,0x03,0x01,
+  0x03,0xA0,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,
+  0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,
+  0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0xA0,0x01,0x03,0x01,0x03,0x18,0x25,0x08,
+  0x2D,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,
+  0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,
+  0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,
+  0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,
+  0x05,0x10,0x05,0x18,0x01,0x03,0x18,0x25,0x08,0x2D,0x18,0x01,0x03,0x01,0x03,0x10,
+  0x0D,0x10,0x0D,0x00,0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x10,0x0D,0x10,0x0D,0x00,0x0D,0x10,0x0D,0x10,0x01,0x03,0x01,0x03,0x30,0x0D,0x08,
+  0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x30,0x0D,0x08,0x0D,
+  0x10,0x0D,0x10,0x01,0x03,0x01,0x03,0x28,0x0D,0x10,0x2D,0x18,0x01,0x03,0x02,0x30,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0x30,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0xA0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x15,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x10,0x01,0x03,0x02,0x30,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0xA0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x20,0x15,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x28,0x0D,0x10,0x2D,0x18,0x01,
+  0x03,0x01,0x03,0x20,0x0D,0x18,0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,
+  0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,
+  0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,
+  0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,
+  0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,
+  0x01,0x03,0x20,0x0D,0x18,0x0D,0x10,0x0D,0x10,0x01,0x03,0x01,0x03,0x18,0x0D,0x20,
+  0x0D,0x10,0x0D,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,
+  0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x10,0x01,0x03,0x18,0x0D,0x20,0x0D,
+  0x10,0x0D,0x10,0x01,0x03,0x01,0x03,0x10,0x35,0x00,0x2D,0x18,0x01,0x03,0x02,0xF8,
+  0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,
+  0x05,0x18,0x01,0x03,0x02,0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,
+  0xF8,0xB8,0x05,0x10,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,
+  0x08,0x05,0x10,0x05,0x18,0x01,0x03,0x02,0xF8,0xB0,0x05,0x00,0x05,0x08,0x05,0x10,
+  0x05,0x18,0x01,0x03,0x10,0x35,0x00,0x2D,0x18,0x01,0x03,0x01,0x03,0xA0,0x01,0x03,
+  0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,
+  0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,0xF8,0x20,0x01,0x03,0x02,0xF8,
+  0xF8,0x20,0x01,0x03,0xA0,0x01,0x03,0x01,0x03,0xA0,0x01,0x03,0xF8,0xF8,0x28,0x01,
+  0x03,0xF8,0xF8,0x28,0x01,0x03,0xF8,0xF8,0x28,0x01,0x03,0xF8,0xF8,0x28,0x01,0x03,
+  0xF8,0xF8,0x28,0x01,0x03,0xF8,0xF8,0x28,0x01,0x03,0xA0,0x01,0x03,0xF9,0xF9,0xF9,
+  0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xFB,0xFB,0xFB,0xFB,
+  0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xFB,0xF8,0xF8,0xF8,0xF8,0xF8,
+  0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8
+};
+
+static const ui_asset_t asset_mock_screen = {
+  480, 320, 3, 8,
+  asset_mock_screen_palette, asset_mock_screen_row_offs, asset_mock_screen_runs
+};
+
+#endif
@@ -0,0 +1,165 @@
+#include <string.h>
+#include "audio_engine.h"
+
+// Rendered blocks alternate between two buffers, so the block handed out by
+// the previous call is still intact while the next one is being rendered.
+static int16_t block_buf[AUDIO_NUM_BUFFERS][AUDIO_BLOCK_SAMPLES] __attribute__((aligned(4)));
+static uint8_t cur_block = 0;
+
+static audio_render_fn renderer = audio_render_silence;
+static void *renderer_ctx = NULL;
+static uint32_t rate_hz = 0;
+static uint32_t blocks_rendered = 0;
+
+enum { GATE_OPEN, GATE_CLOSING, GATE_SHUT, GATE_OPENING };
+static uint8_t gate = GATE_OPEN;
+static int16_t last_out[AUDIO_CHANNELS];   // last sample of the previous block
+static uint32_t mute_fades = 0;
+
+void audio_engine_init(uint32_t sample_rate_hz)
+{
+  rate_hz = sample_rate_hz;
+  blocks_rendered = 0;
+  cur_block = 0;
+  memset(block_buf, 0, sizeof(block_buf));
+  gate = GATE_OPEN;
+  memset(last_out, 0, sizeof(last_out));
+}
+
+// Cuts each channel of a block at its first zero crossing, counting from
+// the last sample of the block before. A channel that never crosses is
+// faded out linearly instead.
+static void gate_close(int16_t *out, uint32_t frames)
+{
+  bool faded = false;
+  for(uint8_t c=0;c<AUDIO_CHANNELS;c++)
+  {
+    bool neg = last_out[c] < 0;
+    uint32_t i = 0;
+    for(;i<frames;i++)
+    {
+      int16_t v = out[i * AUDIO_CHANNELS + c];
+      if(v == 0 || (v < 0) != neg)
+        break;
+    }
+    if(i < frames)
+    {
+      for(;i<frames;i++)
+        out[i * AUDIO_CHANNELS + c] = 0;
+    } else
+    {
+      for(i=0;i<frames;i++)
+        out[i * AUDIO_CHANNELS + c] = (int32_t)out[i * AUDIO_CHANNELS + c] * (int32_t)(frames - 1 - i) / (int32_t)frames;
+      faded = true;
+    }
+  }
+  if(faded)
+    mute_fades++;
+}
+
+static void gate_open(int16_t *out, uint32_t frames)
+{
+  for(uint32_t i=0;i<frames;i++)
+    for(uint8_t c=0;c<AUDIO_CHANNELS;c++)
+      out[i * AUDIO_CHANNELS + c] = (int32_t)out[i * AUDIO_CHANNELS + c] * (int32_t)i / (int32_t)frames;
+}
+
+// Passing NULL selects silence.
+void audio_set_renderer(audio_render_fn fn, void *ctx)
+{
+  renderer_ctx = ctx;
+  renderer = fn ? fn : audio_render_silence;
+}
+
+// Renders the next block and returns it. The result holds AUDIO_BLOCK_FRAMES
+// interleaved L/R frames (AUDIO_BLOCK_BYTES bytes), ready to hand to I2S.
+int16_t *audio_render_block(void)
+{
+  int16_t *out = block_buf[cur_block];
+  if(++cur_block == AUDIO_NUM_BUFFERS)
+    cur_block = 0;
+  switch(gate)
+  {
+  case GATE_SHUT:
+    audio_render_silence(out, AUDIO_BLOCK_FRAMES, NULL);
+    break;
+  case GATE_CLOSING:
+    renderer(out, AUDIO_BLOCK_FRAMES, renderer_ctx);
+    gate_close(out, AUDIO_BLOCK_FRAMES);
+    gate = GATE_SHUT;
+    break;
+  case GATE_OPENING:
+    renderer(out, AUDIO_BLOCK_FRAMES, renderer_ctx);
+    gate_open(out, AUDIO_BLOCK_FRAMES);
+    gate = GATE_OPEN;
+    break;
+  default:
+    renderer(out, AUDIO_BLOCK_FRAMES, renderer_ctx);
+    break;
+  }
+  for(uint8_t c=0;c<AUDIO_CHANNELS;c++)
+    last_out[c] = out[AUDIO_BLOCK_SAMPLES - AUDIO_CHANNELS + c];
+  blocks_rendered++;
+  return out;
+}
+
+// Takes effect from the next block; renderers see it in audio_sample_rate().
+void audio_set_sample_rate(uint32_t sample_rate_hz)
+{
+  rate_hz = sample_rate_hz;
+}
+
+void audio_mute(void)
+{
+  if(gate == GATE_OPEN || gate == GATE_OPENING)
+    gate = GATE_CLOSING;
+}
+
+void audio_unmute(void)
+{
+  if(gate == GATE_SHUT || gate == GATE_CLOSING)
+    gate = GATE_OPENING;
+}
+
+// True once the block that cut the sound has been rendered.
+bool audio_is_muted(void)
+{
+  return gate == GATE_SHUT;
+}
+
+uint32_t audio_mute_fades(void)
+{
+  return mute_fades;
+}
+
+uint32_t audio_sample_rate(void)
+{
+  return rate_hz;
+}
+
+uint32_t audio_blocks_rendered(void)
+{
+  return blocks_rendered;
+}
+
+void audio_render_silence(int16_t *out, uint32_t frames, void *ctx)
+{
+  (void)ctx;
+  memset(out, 0, frames * AUDIO_CHANNELS * sizeof(int16_t));
+}
+
+// White noise on both channels, the same thing codec_test() used to make
+// with rand(). A xorshift32 yields one whole L/R frame per step.
+void audio_render_noise(int16_t *out, uint32_t frames, void *ctx)
+{
+  (void)ctx;
+  static uint32_t x = 0x2545F491;
+  uint32_t *p = (uint32_t *)out;
+  for(uint32_t i=0;i<frames;i++)
+  {
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    p[i] = x;
+  }
+}
@@ -0,0 +1,42 @@
+#ifndef __AUDIO_ENGINE_H__
+#define __AUDIO_ENGINE_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+// The render engine works in blocks that match the I2S DMA buffers set up
+// with i2s.setBuffers(AUDIO_NUM_BUFFERS, AUDIO_BLOCK_FRAMES, 0). Each buffer
+// is AUDIO_BLOCK_FRAMES 32-bit words, and at 16 bits per sample one word
+// holds one interleaved L/R frame, so one render block fills one buffer.
+#define AUDIO_NUM_BUFFERS   2
+#define AUDIO_BLOCK_FRAMES  256
+#define AUDIO_CHANNELS      2
+#define AUDIO_BLOCK_SAMPLES (AUDIO_BLOCK_FRAMES * AUDIO_CHANNELS)
+#define AUDIO_BLOCK_BYTES   (AUDIO_BLOCK_SAMPLES * sizeof(int16_t))
+
+// For a sample rate change the output is muted first. audio_mute() cuts
+// each channel at its next zero crossing in the following block, or fades
+// it out over that block if it doesn't cross zero, so the cut never
+// clicks. Muted blocks are silent and the renderer isn't run. audio_unmute()
+// fades back in over one block.
+
+// A renderer fills 'frames' interleaved L/R frames starting at 'out'.
+// 'out' is always word aligned, and frames is always AUDIO_BLOCK_FRAMES.
+typedef void (*audio_render_fn)(int16_t *out, uint32_t frames, void *ctx);
+
+void     audio_engine_init(uint32_t sample_rate_hz);
+void     audio_set_renderer(audio_render_fn fn, void *ctx);
+int16_t *audio_render_block(void);
+uint32_t audio_sample_rate(void);
+uint32_t audio_blocks_rendered(void);
+void     audio_set_sample_rate(uint32_t sample_rate_hz);
+void     audio_mute(void);
+void     audio_unmute(void);
+bool     audio_is_muted(void);
+uint32_t audio_mute_fades(void);    // mutes that had to fade a channel
+
+// stock renderers
+void audio_render_silence(int16_t *out, uint32_t frames, void *ctx);
+void audio_render_noise(int16_t *out, uint32_t frames, void *ctx);
+
+#endif
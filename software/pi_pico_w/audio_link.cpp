@@ -0,0 +1,4 @@
+#include "audio_link.h"
+
+spsc_queue<audio_cmd_t, AUDIO_CMD_QUEUE_LEN> audio_cmd_q;
+spsc_queue<audio_evt_t, AUDIO_EVT_QUEUE_LEN> audio_evt_q;
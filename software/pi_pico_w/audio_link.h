@@ -0,0 +1,74 @@
+#ifndef __AUDIO_LINK_H__
+#define __AUDIO_LINK_H__
+
+#include <stdint.h>
+#include "spsc_queue.h"
+
+// Messages between the UI core (core 0) and the audio core (core 1).
+//
+// Core 1 renders audio blocks into the I2S buffers and never waits on
+// core 0. Core 0 runs the display, the keyboard I2C slave and codec control,
+// and talks to core 1 only through these two bounded queues. A slow screen
+// redraw can delay commands, but it can never stall the render loop.
+//
+// A sample rate change is a handshake, since core 0 owns the codec and
+// core 1 the I2S output:
+//
+//   core 0: AUDIO_CMD_RATE       core 1 mutes at a zero crossing, plays out
+//                                the I2S buffers, and retimes I2S
+//   core 1: AUDIO_EVT_PAUSED     core 0 reprograms the codec PLL and dividers
+//   core 0: AUDIO_CMD_RESUME     core 1 fades back in
+//   core 1: AUDIO_EVT_RATE       the new rate is playing
+
+// core 0 -> core 1
+enum
+{
+  AUDIO_CMD_RENDERER = 1,   // a: AUDIO_SRC_*
+  AUDIO_CMD_RATE,           // c: sample rate in Hz
+  AUDIO_CMD_RESUME,         // the codec is at the new rate
+  AUDIO_CMD_NOTE_ON,        // a: note, b: velocity 1..127, c: pan 0..127
+  AUDIO_CMD_NOTE_OFF,       // a: note
+};
+
+enum
+{
+  AUDIO_SRC_SILENCE = 0,
+  AUDIO_SRC_NOISE,
+  AUDIO_SRC_SAMPLER,
+};
+
+typedef struct
+{
+  uint8_t  cmd;
+  uint8_t  a;
+  uint16_t b;
+  uint32_t c;
+} audio_cmd_t;
+
+// core 1 -> core 0
+enum
+{
+  AUDIO_EVT_STARTED = 1,    // I2S is running
+  AUDIO_EVT_FAILED,         // I2S failed to start
+  AUDIO_EVT_STATS,          // a: underruns since last, b: worst render us, c: blocks
+  AUDIO_EVT_PAUSED,         // muted and drained, a: 1 if the mute faded, c: rate in Hz
+  AUDIO_EVT_RATE,           // c: sample rate in Hz now playing
+  AUDIO_EVT_BENCH,          // a: SAMPLER_* path, b: voices, c: us per block
+};
+
+typedef struct
+{
+  uint8_t  evt;
+  uint8_t  a;
+  uint16_t b;
+  uint32_t c;
+} audio_evt_t;
+
+#define AUDIO_CMD_QUEUE_LEN   16
+#define AUDIO_EVT_QUEUE_LEN   16
+#define AUDIO_STATS_BLOCKS    188   // about once a second at 48 kHz
+
+extern spsc_queue<audio_cmd_t, AUDIO_CMD_QUEUE_LEN> audio_cmd_q;
+extern spsc_queue<audio_evt_t, AUDIO_EVT_QUEUE_LEN> audio_evt_q;
+
+#endif
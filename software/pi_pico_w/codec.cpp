@@ -0,0 +1,153 @@
+#include <Arduino.h>
+#include <Wire.h>
+#include "codec.h"
+
+#define REG_KNOWN   1     // shadow holds the register's value
+#define REG_DIRTY   2     // shadow differs from the codec; commit will send it
+
+static TwoWire *wire = NULL;
+static uint8_t dev_addr = 0;
+static uint16_t shadow[CODEC_NUM_REGS];
+static uint8_t flags[CODEC_NUM_REGS];
+static bool settling = false;   // reset, and not yet committed to since
+
+codec_stats_t codec_stats;
+
+// A register write is two bytes: address and data bit 8, then data bits
+// 7..0. 'stop' false ends it with a repeated START instead, keeping the bus.
+static bool send(uint8_t reg, uint16_t val, bool stop)
+{
+  wire->beginTransmission(dev_addr);
+  wire->write((uint8_t)((reg << 1) | ((val >> 8) & 1)));
+  wire->write((uint8_t)(val & 0xFF));
+  if(wire->endTransmission(stop))
+  {
+    codec_stats.errors++;
+    return false;
+  }
+  codec_stats.writes++;
+  if(reg == 0)
+    memset(flags, 0, sizeof(flags));
+  else
+    flags[reg] = REG_KNOWN;
+  return true;
+}
+
+void codec_init(TwoWire *bus, uint8_t addr)
+{
+  wire = bus;
+  dev_addr = addr;
+  memset(flags, 0, sizeof(flags));
+}
+
+void codec_write(uint8_t reg, uint16_t val)
+{
+  if(reg >= CODEC_NUM_REGS)
+    return;
+  val &= 0x1FF;
+  if(reg && (flags[reg] & REG_KNOWN) && !(flags[reg] & REG_DIRTY) && shadow[reg] == val)
+  {
+    codec_stats.skipped++;
+    return;
+  }
+  shadow[reg] = val;
+  send(reg, val, true);
+}
+
+// The register address goes out as a write, then a repeated START reads
+// back its nine bits. Returns false, leaving *val alone, if the codec
+// doesn't answer.
+bool codec_read(uint8_t reg, uint16_t *val)
+{
+  if(reg >= CODEC_NUM_REGS)
+    return false;
+  if(flags[reg] & REG_KNOWN)
+  {
+    *val = shadow[reg];
+    return true;
+  }
+  wire->beginTransmission(dev_addr);
+  wire->write((uint8_t)(reg << 1));
+  if(wire->endTransmission(false) || wire->requestFrom(dev_addr, (size_t)2, true) != 2)
+  {
+    codec_stats.errors++;
+    return false;
+  }
+  uint16_t v = wire->read() << 8;
+  v |= wire->read();
+  codec_stats.reads++;
+  shadow[reg] = v & 0x1FF;
+  flags[reg] = REG_KNOWN;
+  *val = shadow[reg];
+  return true;
+}
+
+void codec_set(uint8_t reg, uint16_t val)
+{
+  if(reg == 0 || reg >= CODEC_NUM_REGS)
+    return;
+  val &= 0x1FF;
+  if((flags[reg] & REG_KNOWN) && shadow[reg] == val)
+  {
+    codec_stats.skipped++;
+    return;
+  }
+  shadow[reg] = val;
+  flags[reg] = REG_KNOWN | REG_DIRTY;
+}
+
+// Without the register's current value there is nothing safe to merge
+// into, so a failed read leaves the register as it was.
+bool codec_modify(uint8_t reg, uint16_t mask, uint16_t val)
+{
+  uint16_t cur;
+  if(!codec_read(reg, &cur))
+    return false;
+  codec_set(reg, (cur & ~mask) | (val & mask));
+  return true;
+}
+
+uint8_t codec_commit(void)
+{
+  uint8_t last = 0;
+  for(uint8_t reg=1;reg<CODEC_NUM_REGS;reg++)
+    if(flags[reg] & REG_DIRTY)
+      last = reg;
+  if(!last)
+    return 0;
+  uint8_t sent = 0;
+  for(uint8_t reg=1;reg<=last;reg++)
+  {
+    if(!(flags[reg] & REG_DIRTY))
+      continue;
+    if(!send(reg, shadow[reg], reg == last))
+      break;    // a NACK ends the session with a STOP; the rest stay dirty
+    sent++;
+  }
+  codec_stats.commits++;
+  if(settling && sent)
+  {
+    settling = false;
+    codec_stats.ready_us = micros();
+  }
+  return sent;
+}
+
+void codec_reset(void)
+{
+  send(0, 0, true);
+  codec_stats.reset_us = micros();
+  settling = true;
+}
+
+void codec_wait_reset(void)
+{
+  while(settling && micros() - codec_stats.reset_us < CODEC_RESET_SETTLE_US)
+    ;
+}
+
+void codec_load(const codec_reg_t *t, uint8_t n)
+{
+  for(uint8_t i=0;i<n;i++)
+    codec_set(t[i].reg, t[i].val);
+}
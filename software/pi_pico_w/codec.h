@@ -0,0 +1,77 @@
+#ifndef __CODEC_H__
+#define __CODEC_H__
+
+#include <stdint.h>
+
+class TwoWire;
+
+// NAU8822 codec control through a RAM shadow of its registers.
+//
+// The codec's registers are write-mostly, so every value written is kept
+// here. Reads come from the shadow, and only a register that has never
+// been written since power-up or reset costs a bus read. Writes that would
+// not change a register are skipped.
+//
+// codec_write() goes out at once. codec_set() and codec_modify() only
+// update the shadow and mark the register dirty, and codec_commit() then
+// sends every dirty register in one bus session, joined by repeated
+// STARTs. That suits volume and EQ changes, which come in bursts.
+//
+// codec_read() returns false if it had to go to the bus and the codec
+// didn't answer; codec_modify() then changes nothing and returns false too.
+//
+// Writing register 0 resets the codec, and forgets the whole shadow.
+//
+// Bring-up is a reset, then a table of register values. codec_reset()
+// doesn't wait for the codec to settle, so other setup can run meanwhile.
+// codec_wait_reset() then waits out whatever is left of the settling time
+// before codec_load() and codec_commit() send the table.
+
+#define CODEC_NUM_REGS  80    // registers 0x00..0x4F
+#define CODEC_RESET_SETTLE_US 1000
+
+typedef struct
+{
+  uint8_t  reg;
+  uint16_t val;
+} codec_reg_t;
+
+// For static_assert on register tables: registers 1..0x4F (0 is the
+// reset), nine-bit values, and each register only once.
+constexpr bool codec_table_ok(const codec_reg_t *t, unsigned n)
+{
+  for(unsigned i=0;i<n;i++)
+  {
+    if(t[i].reg == 0 || t[i].reg >= CODEC_NUM_REGS || t[i].val > 0x1FF)
+      return false;
+    for(unsigned j=0;j<i;j++)
+      if(t[j].reg == t[i].reg)
+        return false;
+  }
+  return true;
+}
+
+typedef struct
+{
+  uint32_t writes;          // registers sent
+  uint32_t skipped;         // writes that changed nothing
+  uint32_t reads;           // bus reads, of registers not yet known
+  uint32_t commits;         // codec_commit() sessions that sent anything
+  uint32_t errors;          // transfers the codec didn't acknowledge
+  uint32_t reset_us;        // micros() at the last reset
+  uint32_t ready_us;        // micros() when the first commit after it finished
+} codec_stats_t;
+
+void     codec_init(TwoWire *bus, uint8_t addr);
+void     codec_write(uint8_t reg, uint16_t val);
+bool     codec_read(uint8_t reg, uint16_t *val);
+void     codec_set(uint8_t reg, uint16_t val);
+bool     codec_modify(uint8_t reg, uint16_t mask, uint16_t val);
+uint8_t  codec_commit(void);        // returns registers sent
+void     codec_reset(void);
+void     codec_wait_reset(void);
+void     codec_load(const codec_reg_t *t, uint8_t n);
+
+extern codec_stats_t codec_stats;
+
+#endif
@@ -0,0 +1,165 @@
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "compositor.h"
+
+// Merge two rectangles when their bounding box wastes no more than this
+// many pixels over the two areas alone. One extra window costs a handful
+// of command bytes, so it is not worth repainting much to save one.
+#define COMP_MERGE_SLACK  (COMP_SCREEN_W * 4)
+
+// Past this fraction of the screen, just repaint all of it.
+#define COMP_FULL_PERCENT 70
+
+static TFT_eSPI *disp = NULL;
+static comp_source_fn bg = NULL;
+static comp_overlay_fn overlay = NULL;
+static comp_rect_t rects[COMP_MAX_RECTS];
+static uint8_t nrects = 0;
+static uint16_t line_buf[COMP_SCREEN_W];
+
+comp_stats_t comp_stats;
+
+static inline int32_t area(const comp_rect_t &r)
+{
+  return (int32_t)r.w * r.h;
+}
+
+static comp_rect_t bounds(const comp_rect_t &a, const comp_rect_t &b)
+{
+  comp_rect_t u;
+  int16_t x1 = max(a.x + a.w, b.x + b.w);
+  int16_t y1 = max(a.y + a.h, b.y + b.h);
+  u.x = min(a.x, b.x);
+  u.y = min(a.y, b.y);
+  u.w = x1 - u.x;
+  u.h = y1 - u.y;
+  return u;
+}
+
+void comp_init(TFT_eSPI *tft, comp_source_fn background)
+{
+  disp = tft;
+  bg = background;
+  nrects = 0;
+  // sources produce native uint16 pixels, the panel wants them big-endian
+  disp->setSwapBytes(true);
+}
+
+void comp_set_background(comp_source_fn background)
+{
+  bg = background;
+  comp_damage_all();
+}
+
+void comp_set_overlay(comp_overlay_fn fn)
+{
+  overlay = fn;
+}
+
+void comp_damage_all(void)
+{
+  rects[0].x = 0;
+  rects[0].y = 0;
+  rects[0].w = COMP_SCREEN_W;
+  rects[0].h = COMP_SCREEN_H;
+  nrects = 1;
+}
+
+void comp_damage(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  // clip to the screen
+  if(x < 0) { w += x; x = 0; }
+  if(y < 0) { h += y; y = 0; }
+  if(x + w > COMP_SCREEN_W) w = COMP_SCREEN_W - x;
+  if(y + h > COMP_SCREEN_H) h = COMP_SCREEN_H - y;
+  if(w <= 0 || h <= 0)
+    return;
+
+  comp_rect_t r = { x, y, w, h };
+
+  // Fold the new rect into any existing one that it overlaps or nearly
+  // touches. A merge can make the result overlap others, so go again until
+  // nothing changes.
+  bool merged = true;
+  while(merged)
+  {
+    merged = false;
+    for(uint8_t i=0;i<nrects;i++)
+    {
+      comp_rect_t u = bounds(rects[i], r);
+      if(area(u) <= area(rects[i]) + area(r) + COMP_MERGE_SLACK)
+      {
+        r = u;
+        rects[i] = rects[--nrects];
+        merged = true;
+        break;
+      }
+    }
+  }
+
+  if(nrects == COMP_MAX_RECTS)
+  {
+    // no room: grow whichever rect gets the least bigger by taking it in
+    uint8_t best = 0;
+    int32_t best_cost = INT32_MAX;
+    for(uint8_t i=0;i<nrects;i++)
+    {
+      int32_t cost = area(bounds(rects[i], r)) - area(rects[i]);
+      if(cost < best_cost)
+      {
+        best_cost = cost;
+        best = i;
+      }
+    }
+    rects[best] = bounds(rects[best], r);
+    return;
+  }
+  rects[nrects++] = r;
+}
+
+bool comp_dirty(void)
+{
+  return nrects != 0;
+}
+
+void comp_flush(void)
+{
+  if(!nrects || !bg)
+    return;
+  uint32_t t0 = micros();
+
+  int32_t total = 0;
+  for(uint8_t i=0;i<nrects;i++)
+    total += area(rects[i]);
+  if(total * 100 >= (int32_t)COMP_SCREEN_W * COMP_SCREEN_H * COMP_FULL_PERCENT)
+    comp_damage_all();
+  if(nrects == 1 && area(rects[0]) == (int32_t)COMP_SCREEN_W * COMP_SCREEN_H)
+    comp_stats.full_redraws++;
+
+  disp->startWrite();
+  for(uint8_t i=0;i<nrects;i++)
+  {
+    const comp_rect_t &r = rects[i];
+    disp->setAddrWindow(r.x, r.y, r.w, r.h);
+    for(int16_t y=r.y;y<r.y+r.h;y++)
+    {
+      bg(r.x, y, r.w, line_buf);
+      disp->pushPixels(line_buf, r.w);
+    }
+    comp_stats.windows++;
+    comp_stats.pixels += area(r);
+  }
+  disp->endWrite();
+
+  // the overlay may draw, and may damage more; take a copy of the list first
+  comp_rect_t done[COMP_MAX_RECTS];
+  uint8_t ndone = nrects;
+  memcpy(done, rects, sizeof(comp_rect_t) * ndone);
+  nrects = 0;
+  if(overlay)
+    for(uint8_t i=0;i<ndone;i++)
+      overlay(&done[i]);
+
+  comp_stats.flushes++;
+  comp_stats.last_flush_us = micros() - t0;
+}
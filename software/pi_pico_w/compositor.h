@@ -0,0 +1,54 @@
+#ifndef __COMPOSITOR_H__
+#define __COMPOSITOR_H__
+
+#include <stdint.h>
+
+class TFT_eSPI;
+
+// Dirty-rectangle display compositor.
+//
+// Code that changes what should be on screen reports the damaged area with
+// comp_damage(). comp_flush() then repaints only those areas. Each one gets
+// a single address-window setup, followed by whole rows of pixels pulled
+// from the background source, so a repaint costs about the raw SPI transfer
+// time of its pixels instead of one command sequence per pixel.
+//
+// Nearby rectangles are merged as they arrive, so a flush never holds more
+// than COMP_MAX_RECTS windows.
+
+#define COMP_SCREEN_W   480
+#define COMP_SCREEN_H   320
+#define COMP_MAX_RECTS  16
+
+typedef struct
+{
+  int16_t x, y, w, h;
+} comp_rect_t;
+
+// Fills 'w' RGB565 pixels of screen row 'y', starting at column 'x'.
+typedef void (*comp_source_fn)(int16_t x, int16_t y, int16_t w, uint16_t *line);
+
+// Called for each rectangle after it has been repainted, so layers drawn on
+// top of the background (text, meters) can put themselves back.
+typedef void (*comp_overlay_fn)(const comp_rect_t *r);
+
+typedef struct
+{
+  uint32_t flushes;
+  uint32_t full_redraws;    // flushes that covered the whole screen
+  uint32_t windows;         // address windows set up
+  uint32_t pixels;          // pixels pushed
+  uint32_t last_flush_us;
+} comp_stats_t;
+
+void comp_init(TFT_eSPI *tft, comp_source_fn background);
+void comp_set_background(comp_source_fn background);
+void comp_set_overlay(comp_overlay_fn overlay);
+void comp_damage(int16_t x, int16_t y, int16_t w, int16_t h);
+void comp_damage_all(void);
+bool comp_dirty(void);
+void comp_flush(void);
+
+extern comp_stats_t comp_stats;
+
+#endif
@@ -21,4 +21,14 @@
 
 #define SAMPLE_RATE_HZ 48000
 
+// sampler voices on the audio core (host/sampler_bench shows what fits)
+#define AUDIO_VOICES 16
+// 1 times each sampler render path on the audio core before I2S starts,
+// and prints the results
+#define AUDIO_BENCH_AT_BOOT 0
+
+// keyboard controller full scan rate, must match KB_FULLSCAN_HZ in the
+// atmega328p_keys_and_leds firmware
+#define KB_FULLSCAN_HZ 1000
+
 #endif
\ No newline at end of file
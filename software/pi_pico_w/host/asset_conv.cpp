@@ -0,0 +1,247 @@
+// Converts an image into the compressed UI asset format of asset.h, and
+// writes it out as a C header for the sketch.
+//
+//   asset_conv -gimp image.h       name out.h   GIMP "C source" RGB16 dump
+//   asset_conv -ppm image.ppm      name out.h   binary PPM (P6), reduced to RGB565
+//   asset_conv -raw WxH image.bin  name out.h   little-endian RGB565
+//
+// The palette is every distinct color in the image, so the source has to
+// be drawn or reduced to at most 256 colors first. The index width is the
+// smallest that fits the palette. Run lengths get whatever is left of each
+// byte, or a byte of their own when the palette needs all 8 bits.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <string>
+#include <vector>
+#include <map>
+
+static std::vector<uint16_t> pixels;
+static int width = 0, height = 0;
+
+static bool read_file(const char *path, std::string &out)
+{
+  FILE *f = fopen(path, "rb");
+  if(!f)
+    return false;
+  char buf[65536];
+  size_t n;
+  while((n = fread(buf, 1, sizeof(buf), f)) > 0)
+    out.append(buf, n);
+  fclose(f);
+  return true;
+}
+
+// GIMP C source: "W, H, BPP," followed by string literals holding the
+// pixel bytes, with octal escapes for anything unprintable.
+static bool load_gimp(const char *path)
+{
+  std::string s;
+  if(!read_file(path, s))
+    return false;
+  size_t i = s.find('=');
+  if(i == std::string::npos || (i = s.find('{', i)) == std::string::npos)
+    return false;
+  int bpp;
+  if(sscanf(s.c_str() + i + 1, " %d , %d , %d", &width, &height, &bpp) != 3 || bpp != 2)
+  {
+    fprintf(stderr, "%s: expected an RGB16 (2 bytes per pixel) dump\n", path);
+    return false;
+  }
+  std::vector<uint8_t> bytes;
+  for(i = s.find('"', i); i < s.size() && s[i] != '}'; i++)
+  {
+    if(s[i] != '"')
+      continue;
+    for(i++; i < s.size() && s[i] != '"'; i++)
+    {
+      char c = s[i];
+      if(c != '\\')
+      {
+        bytes.push_back(c);
+        continue;
+      }
+      c = s[++i];
+      if(c >= '0' && c <= '7')
+      {
+        int v = 0;
+        for(int k=0;k<3 && s[i] >= '0' && s[i] <= '7';k++)
+          v = v * 8 + (s[i++] - '0');
+        i--;
+        bytes.push_back(v);
+      } else
+      {
+        static const char esc[] = "n\nt\tr\ra\ab\bf\fv\v";
+        const char *e = strchr(esc, c);
+        bytes.push_back(e && !((e - esc) & 1) ? e[1] : c);
+      }
+    }
+  }
+  if(bytes.size() < (size_t)width * height * 2)
+  {
+    fprintf(stderr, "%s: only %zu pixel bytes\n", path, bytes.size());
+    return false;
+  }
+  pixels.resize(width * height);
+  for(size_t p=0;p<pixels.size();p++)
+    pixels[p] = bytes[p * 2] | (bytes[p * 2 + 1] << 8);
+  return true;
+}
+
+static bool load_ppm(const char *path)
+{
+  std::string s;
+  if(!read_file(path, s) || s.compare(0, 2, "P6"))
+    return false;
+  size_t i = 2;
+  int vals[3], nv = 0;
+  while(nv < 3 && i < s.size())
+  {
+    if(s[i] == '#')
+      while(i < s.size() && s[i] != '\n') i++;
+    else if(isdigit((unsigned char)s[i]))
+    {
+      vals[nv] = 0;
+      while(i < s.size() && isdigit((unsigned char)s[i]))
+        vals[nv] = vals[nv] * 10 + (s[i++] - '0');
+      nv++;
+      continue;
+    }
+    i++;
+  }
+  i++;  // single whitespace after maxval
+  width = vals[0];
+  height = vals[1];
+  if(nv < 3 || vals[2] != 255 || s.size() < i + (size_t)width * height * 3)
+  {
+    fprintf(stderr, "%s: need an 8-bit binary PPM\n", path);
+    return false;
+  }
+  pixels.resize(width * height);
+  const uint8_t *p = (const uint8_t *)s.data() + i;
+  for(size_t k=0;k<pixels.size();k++, p+=3)
+    pixels[k] = ((p[0] & 0xF8) << 8) | ((p[1] & 0xFC) << 3) | (p[2] >> 3);
+  return true;
+}
+
+static bool load_raw(const char *dims, const char *path)
+{
+  std::string s;
+  if(sscanf(dims, "%dx%d", &width, &height) != 2 || !read_file(path, s) ||
+     s.size() < (size_t)width * height * 2)
+    return false;
+  pixels.resize(width * height);
+  for(size_t k=0;k<pixels.size();k++)
+    pixels[k] = (uint8_t)s[k * 2] | ((uint8_t)s[k * 2 + 1] << 8);
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  int a = 1;
+  bool ok = false;
+  if(argc == 5 && !strcmp(argv[1], "-gimp"))
+    ok = load_gimp(argv[2]), a = 3;
+  else if(argc == 5 && !strcmp(argv[1], "-ppm"))
+    ok = load_ppm(argv[2]), a = 3;
+  else if(argc == 6 && !strcmp(argv[1], "-raw"))
+    ok = load_raw(argv[2], argv[3]), a = 4;
+  else
+  {
+    fprintf(stderr, "usage: %s -gimp image.h | -ppm image.ppm | -raw WxH image.bin  name out.h\n", argv[0]);
+    return 1;
+  }
+  if(!ok)
+  {
+    fprintf(stderr, "can't load image\n");
+    return 1;
+  }
+  const char *name = argv[a];
+  const char *out_path = argv[a + 1];
+
+  // palette, in order of first appearance
+  std::map<uint16_t, int> index;
+  std::vector<uint16_t> palette;
+  for(uint16_t c : pixels)
+  {
+    if(index.count(c))
+      continue;
+    index[c] = palette.size();
+    palette.push_back(c);
+  }
+  if(palette.size() > 256)
+  {
+    fprintf(stderr, "%zu colors; reduce the image to 256 or fewer first\n", palette.size());
+    return 1;
+  }
+  int idx_bits = 1;
+  while((1u << idx_bits) < palette.size())
+    idx_bits++;
+  int max_run = idx_bits == 8 ? 256 : 1 << (8 - idx_bits);
+
+  std::vector<uint8_t> runs;
+  std::vector<uint32_t> row_offs;
+  for(int y=0;y<height;y++)
+  {
+    row_offs.push_back(runs.size());
+    const uint16_t *row = &pixels[y * width];
+    for(int x=0;x<width;)
+    {
+      int len = 1;
+      while(x + len < width && len < max_run && row[x + len] == row[x])
+        len++;
+      int idx = index[row[x]];
+      if(idx_bits == 8)
+      {
+        runs.push_back(idx);
+        runs.push_back(len - 1);
+      } else
+        runs.push_back(idx | ((len - 1) << idx_bits));
+      x += len;
+    }
+  }
+
+  FILE *f = fopen(out_path, "w");
+  if(!f)
+  {
+    fprintf(stderr, "can't write %s\n", out_path);
+    return 1;
+  }
+  std::string guard = "__";
+  for(const char *c = name; *c; c++)
+    guard += toupper((unsigned char)*c);
+  guard += "_H__";
+  fprintf(f, "#ifndef %s\n#define %s\n\n", guard.c_str(), guard.c_str());
+  fprintf(f, "// Generated by host/asset_conv. Do not edit.\n");
+  fprintf(f, "// %dx%d, %zu colors, %zu bytes of runs\n\n", width, height, palette.size(), runs.size());
+  fprintf(f, "#include \"asset.h\"\n\n");
+
+  fprintf(f, "static const uint16_t %s_palette[%zu] = {", name, palette.size());
+  for(size_t i=0;i<palette.size();i++)
+    fprintf(f, "%s0x%04X", !i ? "\n  " : i % 8 ? ", " : ",\n  ", palette[i]);
+  fprintf(f, "\n};\n\n");
+
+  fprintf(f, "static const uint32_t %s_row_offs[%d] = {", name, height);
+  for(int i=0;i<height;i++)
+    fprintf(f, "%s%u", !i ? "\n  " : i % 10 ? ", " : ",\n  ", row_offs[i]);
+  fprintf(f, "\n};\n\n");
+
+  fprintf(f, "static const uint8_t %s_runs[%zu] = {", name, runs.size());
+  for(size_t i=0;i<runs.size();i++)
+    fprintf(f, "%s0x%02X", !i ? "\n  " : i % 16 ? "," : ",\n  ", runs[i]);
+  fprintf(f, "\n};\n\n");
+
+  fprintf(f, "static const ui_asset_t %s = {\n  %d, %d, %d, %zu,\n  %s_palette, %s_row_offs, %s_runs\n};\n\n",
+          name, width, height, idx_bits, palette.size(), name, name, name);
+  fprintf(f, "#endif\n");
+  fclose(f);
+
+  size_t raw = (size_t)width * height * 2;
+  size_t packed = palette.size() * 2 + row_offs.size() * 4 + runs.size();
+  printf("%s: %dx%d, %zu colors, %d-bit index, %zu -> %zu bytes (%.1f%%)\n", name, width, height,
+         palette.size(), idx_bits, raw, packed, 100.0 * packed / raw);
+  return 0;
+}
@@ -0,0 +1,30 @@
+#ifndef __BENCH_CLOCK_H__
+#define __BENCH_CLOCK_H__
+
+#include <stdint.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// Timing helpers for the host benchmarks, here and in the keyboard
+// controller's host build, which takes this header from this folder.
+// bench_cycles() reads the CPU timestamp counter where there is one, and
+// falls back to nanoseconds.
+static inline uint64_t bench_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static inline uint64_t bench_cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return bench_ns();
+#endif
+}
+
+#endif
@@ -0,0 +1,62 @@
+#include <string.h>
+#include "blockdev_file.h"
+#include "stream.h"
+
+bool blockdev_file_attach(blockdev_file_t *d, FILE *f)
+{
+  if(!f)
+    return false;
+  fseek(f, 0, SEEK_END);
+  long len = ftell(f);
+  d->f = f;
+  d->blocks = len / STREAM_BLOCK_BYTES;
+  d->reads = 0;
+  d->stalls = 0;
+  d->busy_us = 0;
+  d->max_us = 0;
+  if(!d->rng)
+    d->rng = 0x9E3779B9;
+  return true;
+}
+
+bool blockdev_file_open(blockdev_file_t *d, const char *path)
+{
+  return blockdev_file_attach(d, fopen(path, "rb"));
+}
+
+void blockdev_file_close(blockdev_file_t *d)
+{
+  if(d->f)
+    fclose(d->f);
+  d->f = NULL;
+}
+
+bool blockdev_file_read(void *ctx, uint32_t block, uint32_t count, uint8_t *dst)
+{
+  blockdev_file_t *d = (blockdev_file_t *)ctx;
+  if(!d->f || block + count > d->blocks)
+    return false;
+  fseek(d->f, (long)block * STREAM_BLOCK_BYTES, SEEK_SET);
+  bool ok = fread(dst, STREAM_BLOCK_BYTES, count, d->f) == count;
+
+  uint32_t us = d->cmd_us + d->block_us * count;
+  if(d->jitter_us)
+  {
+    d->rng ^= d->rng << 13;
+    d->rng ^= d->rng >> 17;
+    d->rng ^= d->rng << 5;
+    us += d->rng % (d->jitter_us + 1);
+  }
+  d->reads++;
+  if(d->stall_every && d->reads % d->stall_every == 0)
+  {
+    us += d->stall_us;
+    d->stalls++;
+  }
+  d->busy_us += us;
+  if(us > d->max_us)
+    d->max_us = us;
+  if(d->wait_us)
+    d->wait_us(us);
+  return ok;
+}
@@ -0,0 +1,39 @@
+#ifndef __BLOCKDEV_FILE_H__
+#define __BLOCKDEV_FILE_H__
+
+#include <stdio.h>
+#include <stdint.h>
+
+// File-backed block device for the host builds of stream.cpp, with SD card
+// read timing put back in. Every read costs cmd_us, plus block_us for each
+// block, plus a random extra of up to jitter_us, and every stall_every'th
+// read also stalls for stall_us. The time goes through wait_us(), which the
+// caller supplies, so a bench can run on simulated time and a real-time
+// simulator can just sleep.
+
+typedef struct
+{
+  FILE    *f;
+  uint32_t blocks;
+  // latency model
+  uint32_t cmd_us;
+  uint32_t block_us;
+  uint32_t jitter_us;
+  uint32_t stall_us;
+  uint32_t stall_every;     // 0 for no stalls
+  void   (*wait_us)(uint32_t us);
+  // counted
+  uint32_t reads;
+  uint32_t stalls;
+  uint64_t busy_us;
+  uint32_t max_us;
+  uint32_t rng;
+} blockdev_file_t;
+
+bool blockdev_file_open(blockdev_file_t *d, const char *path);
+bool blockdev_file_attach(blockdev_file_t *d, FILE *f);
+void blockdev_file_close(blockdev_file_t *d);
+// a stream_dev_t read function; ctx is the blockdev_file_t
+bool blockdev_file_read(void *ctx, uint32_t block, uint32_t count, uint8_t *dst);
+
+#endif
@@ -0,0 +1,191 @@
+// Host simulator for the whole Pi Pico firmware. pi_pico_w.ino is built
+// against the stand-ins in sim/ for Arduino, TFT_eSPI, I2S and Wire, and
+// run on two threads like the two RP2040 cores: setup() and loop() on one,
+// setup1() and loop1() on the other.
+//
+// The display is drawn into a framebuffer with its SPI traffic counted, the
+// audio plays out in real time into a WAV file, the codec is a register
+// model, and the keyboard controller's frames are played back from a
+// recording. At the end the simulator reports what each of them cost.
+//
+//   pico_sim [-s seconds] [-k frames.txt] [-o out.wav] [-p screen.ppm]
+//            [-n] [-r rate]...
+//
+// -n plays noise instead of silence. Each -r switches the sample rate, at
+// even spacing through the run, the way a song change would. The WAV file
+// keeps the rate it started at.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <thread>
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <I2S.h>
+#include <Wire.h>
+#include "nau8822_sim.h"
+#include "defines.h"
+#include "kb_link.h"
+#include "compositor.h"
+#include "text_layer.h"
+#include "audio_engine.h"
+#include "codec.h"
+#include "audio_link.h"
+#include "sampler.h"
+
+void setup(void);
+void loop(void);
+void setup1(void);
+void loop1(void);
+bool audio_change_rate(uint32_t hz);
+uint8_t key_led_level(uint8_t velocity);
+
+static std::atomic<bool> stop{false};
+
+static void core1(void)
+{
+  setup1();
+  while(!stop)
+    loop1();
+}
+
+int main(int argc, char **argv)
+{
+  const char *wav_path = "pico_sim.wav";
+  const char *ppm_path = "pico_sim.ppm";
+  const char *kb_path = NULL;
+  double seconds = 5.0;
+  bool noise = false;
+  uint32_t rates[16];
+  unsigned n_rates = 0;
+
+  for(int i=1;i<argc;i++)
+  {
+    if(!strcmp(argv[i], "-s") && i+1 < argc)
+      seconds = atof(argv[++i]);
+    else if(!strcmp(argv[i], "-k") && i+1 < argc)
+      kb_path = argv[++i];
+    else if(!strcmp(argv[i], "-o") && i+1 < argc)
+      wav_path = argv[++i];
+    else if(!strcmp(argv[i], "-p") && i+1 < argc)
+      ppm_path = argv[++i];
+    else if(!strcmp(argv[i], "-n"))
+      noise = true;
+    else if(!strcmp(argv[i], "-r") && i+1 < argc && n_rates < 16)
+      rates[n_rates++] = atoi(argv[++i]);
+    else
+    {
+      fprintf(stderr, "usage: %s [-s seconds] [-k frames.txt] [-o out.wav] [-p screen.ppm] [-n] [-r rate]...\n", argv[0]);
+      return 1;
+    }
+  }
+  if(kb_path && !wire_sim_load(kb_path))
+  {
+    fprintf(stderr, "can't read %s\n", kb_path);
+    return 1;
+  }
+
+  i2s_sim_open_wav(wav_path);
+  nau8822_sim_attach(Wire1, NAU8822_I2C_ADDRESS);
+  Wire.setClock(400000);    // the keyboard controller's TWI clock
+
+  std::thread c1(core1);
+  uint32_t boot = micros();
+  setup();
+  uint32_t setup_us = micros() - boot;
+  tft_sim_stats_t tft_setup = tft_sim_stats;
+  wire_sim_stats_t codec_setup = Wire1.stats;
+  if(noise)
+  {
+    audio_cmd_t c = { AUDIO_CMD_RENDERER, AUDIO_SRC_NOISE, 0, 0 };
+    audio_cmd_q.push(c);
+  }
+  unsigned next_rate = 0;
+  unsigned rate_refused = 0;
+
+  // core 0, with keyboard traffic landing between passes of loop()
+  uint32_t t0 = micros();
+  uint32_t run_us = (uint32_t)(seconds * 1e6);
+  uint32_t passes = 0;
+  uint64_t loop_us_sum = 0;
+  uint32_t loop_us_max = 0;
+  for(;;)
+  {
+    uint32_t now = micros() - t0;
+    if(now >= run_us)
+      break;
+    wire_sim_poll(now);
+    if(next_rate < n_rates && now >= (uint64_t)run_us * (next_rate + 1) / (n_rates + 1))
+    {
+      if(!audio_change_rate(rates[next_rate]))
+        rate_refused++;
+      next_rate++;
+    }
+    uint32_t l0 = micros();
+    loop();
+    uint32_t us = micros() - l0;
+    loop_us_sum += us;
+    if(us > loop_us_max)
+      loop_us_max = us;
+    passes++;
+  }
+  stop = true;
+  c1.join();
+  i2s_sim_close();
+  if(!tft_sim_save_ppm(ppm_path))
+    fprintf(stderr, "can't write %s\n", ppm_path);
+
+  const tft_sim_stats_t &d = tft_sim_stats;
+  printf("\n--- %.1f s simulated, core 0: %u loop() passes, mean %.1f us, max %u us\n",
+         seconds, passes, passes ? (double)loop_us_sum / passes : 0.0, loop_us_max);
+  printf("display: %u commands, %u data bytes, %u windows, %u pixels, %u chars\n",
+         d.commands, d.data_bytes, d.windows, d.pixels, d.chars);
+  printf("  SPI time at %.0f MHz: %.1f ms, %.1f ms of it after setup()\n",
+         TFT_SIM_SPI_HZ / 1e6, tft_sim_spi_us() / 1000,
+         (tft_sim_spi_us() - ((double)tft_setup.commands * 2 + tft_setup.data_bytes) * 8e6 / TFT_SIM_SPI_HZ) / 1000);
+  printf("  compositor: %u flushes, %u full, %u windows, %u pixels; text: %u cells drawn, %u skipped\n",
+         comp_stats.flushes, comp_stats.full_redraws, comp_stats.windows, comp_stats.pixels,
+         text_stats.cells_drawn, text_stats.cells_skipped);
+  printf("audio: %u buffers played, %u underruns, %u rate changes -> %s\n",
+         i2s_sim_stats.buffers_played, i2s_sim_stats.underruns, i2s_sim_stats.rate_changes, wav_path);
+  printf("  sampler: %u notes, %u voices at most, %u stolen\n",
+         sampler_stats.notes, sampler_stats.peak_voices, sampler_stats.steals);
+  if(n_rates)
+    printf("  %u rate switches asked for, %u refused; %u mutes faded for want of a zero crossing; now %u Hz\n",
+           n_rates, rate_refused, audio_mute_fades(), audio_sample_rate());
+  printf("keyboard: %u frames replayed%s, %u queued, %u dropped, %u seq gaps, %u keyframes\n",
+         wire_sim_replay_stats.frames, kb_path && !wire_sim_replay_done() ? " (recording not finished)" : "",
+         kb_stats.received, kb_stats.dropped, kb_stats.seq_gaps, kb_stats.keyframes);
+  printf("  %u LED frame reads, %u bytes; bus busy %.1f ms at %.0f kHz\n",
+         wire_sim_replay_stats.led_reads, wire_sim_replay_stats.led_bytes,
+         Wire.stats.bus_us / 1000, Wire.clock_hz / 1e3);
+  printf("codec: %u writes, %u reads, %u bytes, %u NACKs, bus busy %.1f ms (%.1f ms after setup())\n",
+         Wire1.stats.writes, Wire1.stats.reads, Wire1.stats.bytes, Wire1.stats.nacks,
+         Wire1.stats.bus_us / 1000, (Wire1.stats.bus_us - codec_setup.bus_us) / 1000);
+  printf("  shadow: %u writes, %u skipped, %u reads, %u commits, %u errors\n",
+         codec_stats.writes, codec_stats.skipped, codec_stats.reads, codec_stats.commits, codec_stats.errors);
+  printf("  NAU8822: %u registers written, %u resets, %u pointer-only writes, %u stray bytes, %u reads\n",
+         nau8822_sim.writes, nau8822_sim.resets, nau8822_sim.pointer_writes,
+         nau8822_sim.extra_bytes, nau8822_sim.reads);
+  printf("  bring-up: ready %.2f ms after boot, %.2f ms after reset; %u writes while settling; setup() %.1f ms\n",
+         (codec_stats.ready_us - boot) / 1000.0, (codec_stats.ready_us - codec_stats.reset_us) / 1000.0,
+         nau8822_sim.early_writes, setup_us / 1000.0);
+  printf("screen -> %s\n", ppm_path);
+
+  // every press velocity has to light its LED, 127 (the hardest, and what
+  // keyframe presses carry) included
+  int bad = 0;
+  for(int v=1;v<=127;v++)
+  {
+    uint8_t level = key_led_level(v);
+    if(level < 1 || level > 15 || (v == 127 && level != 15))
+    {
+      fprintf(stderr, "key LED: velocity %d gives level %u\n", v, level);
+      bad++;
+    }
+  }
+  printf("key LEDs: velocities 1..127 -> levels %u..%u%s\n",
+         key_led_level(1), key_led_level(127), bad ? ", FAILED" : "");
+  return bad ? 2 : 0;
+}
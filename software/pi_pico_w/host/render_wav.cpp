@@ -0,0 +1,74 @@
+// Host build of the audio render engine. Renders a few seconds of audio to a
+// WAV file, timing every block so the cost per block can be compared with
+// the real-time budget of one I2S buffer.
+//
+//   render_wav [-s seconds] [-r rate] [-o out.wav]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "audio_engine.h"
+#include "defines.h"
+#include "wav_writer.h"
+#include "bench_clock.h"
+
+int main(int argc, char **argv)
+{
+  const char *out_path = "render.wav";
+  double seconds = 5.0;
+  uint32_t rate = SAMPLE_RATE_HZ;
+
+  for(int i=1;i<argc;i++)
+  {
+    if(!strcmp(argv[i], "-o") && i+1 < argc)
+      out_path = argv[++i];
+    else if(!strcmp(argv[i], "-s") && i+1 < argc)
+      seconds = atof(argv[++i]);
+    else if(!strcmp(argv[i], "-r") && i+1 < argc)
+      rate = atoi(argv[++i]);
+    else
+    {
+      fprintf(stderr, "usage: %s [-s seconds] [-r rate] [-o out.wav]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  wav_writer_t wav;
+  if(!wav_open(&wav, out_path, rate, AUDIO_CHANNELS))
+  {
+    fprintf(stderr, "can't open %s\n", out_path);
+    return 1;
+  }
+
+  audio_engine_init(rate);
+  audio_set_renderer(audio_render_noise, NULL);
+
+  uint32_t nblocks = (uint32_t)(seconds * rate / AUDIO_BLOCK_FRAMES);
+  uint64_t cyc_min = UINT64_MAX, cyc_max = 0, cyc_sum = 0;
+  uint64_t ns_sum = 0;
+  for(uint32_t b=0;b<nblocks;b++)
+  {
+    uint64_t t0 = bench_ns();
+    uint64_t c0 = bench_cycles();
+    int16_t *blk = audio_render_block();
+    uint64_t c = bench_cycles() - c0;
+    ns_sum += bench_ns() - t0;
+    cyc_sum += c;
+    if(c < cyc_min) cyc_min = c;
+    if(c > cyc_max) cyc_max = c;
+    wav_write(&wav, blk, AUDIO_BLOCK_FRAMES);
+  }
+  wav_close(&wav);
+
+  if(!nblocks)
+    return 0;
+  double block_us = 1e6 * AUDIO_BLOCK_FRAMES / rate;
+  double avg_us = ns_sum / 1000.0 / nblocks;
+  printf("%u blocks of %d frames at %u Hz -> %s\n", nblocks, AUDIO_BLOCK_FRAMES, rate, out_path);
+  printf("cycles/block: min %llu avg %llu max %llu\n",
+         (unsigned long long)cyc_min, (unsigned long long)(cyc_sum / nblocks),
+         (unsigned long long)cyc_max);
+  printf("time/block:   avg %.2f us of %.2f us budget (%.3f%% of real time)\n",
+         avg_us, block_us, 100.0 * avg_us / block_us);
+  return 0;
+}
@@ -0,0 +1,218 @@
+// Converts a WAV file into a sampler sample (sampler.h), and writes it out
+// as a C header for the sketch.
+//
+//   sample_conv [-pcm] [-root note] [-loop start,end] in.wav name out.h
+//
+// The input is 16-bit PCM, mono or stereo; stereo is mixed down to mono.
+// The sample is stored as IMA-ADPCM (adpcm.h), a quarter of the size, or
+// as 16-bit PCM with -pcm. The root note and the loop come from the WAV's
+// smpl chunk if it has one, and -root and -loop override them; the loop
+// end is the frame after the last one looped. It prints what the encoding
+// cost in noise, so a sample that suffers from ADPCM can be kept as PCM.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <math.h>
+#include <string>
+#include <vector>
+#include "adpcm.h"
+
+static std::vector<int16_t> frames;
+static uint32_t rate_hz = 0;
+static int root_note = 60;
+static uint32_t loop_start = 0, loop_end = 0;
+
+static uint32_t get16(const uint8_t *p)
+{
+  return p[0] | p[1] << 8;
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+  return get16(p) | get16(p + 2) << 16;
+}
+
+static bool load_wav(const char *path)
+{
+  FILE *f = fopen(path, "rb");
+  if(!f)
+    return false;
+  std::vector<uint8_t> s;
+  uint8_t buf[65536];
+  size_t n;
+  while((n = fread(buf, 1, sizeof(buf), f)) > 0)
+    s.insert(s.end(), buf, buf + n);
+  fclose(f);
+  if(s.size() < 12 || memcmp(&s[0], "RIFF", 4) || memcmp(&s[8], "WAVE", 4))
+  {
+    fprintf(stderr, "%s: not a WAV file\n", path);
+    return false;
+  }
+
+  uint32_t channels = 0, bits = 0;
+  const uint8_t *data = NULL;
+  uint32_t data_bytes = 0;
+  for(size_t i=12;i + 8 <= s.size();)
+  {
+    const uint8_t *c = &s[i];
+    uint32_t len = get32(c + 4);
+    if(len > s.size() - i - 8)
+      len = s.size() - i - 8;
+    if(!memcmp(c, "fmt ", 4) && len >= 16)
+    {
+      if(get16(c + 8) != 1)
+      {
+        fprintf(stderr, "%s: only PCM WAV files\n", path);
+        return false;
+      }
+      channels = get16(c + 10);
+      rate_hz = get32(c + 12);
+      bits = get16(c + 22);
+    } else if(!memcmp(c, "data", 4))
+    {
+      data = c + 8;
+      data_bytes = len;
+    } else if(!memcmp(c, "smpl", 4) && len >= 36)
+    {
+      root_note = get32(c + 8 + 12) & 0x7F;
+      if(get32(c + 8 + 28) && len >= 60)
+      {
+        loop_start = get32(c + 8 + 36 + 8);
+        loop_end = get32(c + 8 + 36 + 12) + 1;
+      }
+    }
+    i += 8 + len + (len & 1);
+  }
+  if(!data || bits != 16 || channels < 1 || channels > 2 || !rate_hz)
+  {
+    fprintf(stderr, "%s: expected 16-bit PCM, mono or stereo\n", path);
+    return false;
+  }
+  uint32_t n_frames = data_bytes / (2 * channels);
+  for(uint32_t i=0;i<n_frames;i++)
+  {
+    const uint8_t *p = data + i * 2 * channels;
+    int32_t x = (int16_t)get16(p);
+    if(channels == 2)
+      x = (x + (int16_t)get16(p + 2)) >> 1;
+    frames.push_back(x);
+  }
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  bool pcm = false;
+  int root = -1;
+  int64_t ls = -1, le = -1;
+  int a = 1;
+  for(;a<argc && argv[a][0] == '-';a++)
+  {
+    if(!strcmp(argv[a], "-pcm"))
+      pcm = true;
+    else if(!strcmp(argv[a], "-root") && a+1 < argc)
+      root = atoi(argv[++a]);
+    else if(!strcmp(argv[a], "-loop") && a+1 < argc)
+    {
+      long s, e;
+      if(sscanf(argv[++a], "%ld,%ld", &s, &e) != 2)
+        break;
+      ls = s;
+      le = e;
+    } else
+      break;
+  }
+  if(argc - a != 3)
+  {
+    fprintf(stderr, "usage: %s [-pcm] [-root note] [-loop start,end] in.wav name out.h\n", argv[0]);
+    return 1;
+  }
+  if(!load_wav(argv[a]))
+  {
+    fprintf(stderr, "can't load %s\n", argv[a]);
+    return 1;
+  }
+  const char *name = argv[a + 1];
+  const char *out_path = argv[a + 2];
+  if(root >= 0)
+    root_note = root & 0x7F;
+  if(ls >= 0)
+  {
+    loop_start = ls;
+    loop_end = le;
+  }
+  uint32_t n = frames.size();
+  if(n < 4 || n > (1u << 19))
+  {
+    fprintf(stderr, "%u frames; a sample has to be 4 to %u frames long\n", n, 1u << 19);
+    return 1;
+  }
+  if(loop_end && (loop_end > n || loop_end < loop_start + 4))
+  {
+    fprintf(stderr, "loop %u..%u doesn't fit %u frames; playing it as a one-shot\n", loop_start, loop_end, n);
+    loop_start = loop_end = 0;
+  }
+
+  // encode, and decode again to see what it cost
+  std::vector<uint8_t> blocks(adpcm_bytes(n));
+  adpcm_encode(&frames[0], n, &blocks[0]);
+  std::vector<int16_t> dec(blocks.size() / ADPCM_BLOCK_BYTES * ADPCM_BLOCK_FRAMES);
+  for(size_t b=0;b<blocks.size() / ADPCM_BLOCK_BYTES;b++)
+    adpcm_decode_block(&blocks[b * ADPCM_BLOCK_BYTES], &dec[b * ADPCM_BLOCK_FRAMES], ADPCM_BLOCK_FRAMES);
+  double sig = 0, err = 0;
+  for(uint32_t i=0;i<n;i++)
+  {
+    double e = dec[i] - frames[i];
+    sig += (double)frames[i] * frames[i];
+    err += e * e;
+  }
+  double snr = 10 * log10(sig / (err ? err : 1e-9));
+
+  FILE *f = fopen(out_path, "w");
+  if(!f)
+  {
+    fprintf(stderr, "can't write %s\n", out_path);
+    return 1;
+  }
+  std::string guard = "__";
+  for(const char *c = name; *c; c++)
+    guard += toupper((unsigned char)*c);
+  guard += "_H__";
+  fprintf(f, "#ifndef %s\n#define %s\n\n", guard.c_str(), guard.c_str());
+  fprintf(f, "// Generated by host/sample_conv. Do not edit.\n");
+  fprintf(f, "// %u frames at %u Hz, root note %d, ", n, rate_hz, root_note);
+  if(loop_end)
+    fprintf(f, "looped over %u..%u, ", loop_start, loop_end);
+  if(pcm)
+    fprintf(f, "16-bit PCM\n\n");
+  else
+    fprintf(f, "IMA-ADPCM (%.1f dB SNR)\n\n", snr);
+  fprintf(f, "#include \"sampler.h\"\n\n");
+
+  if(pcm)
+  {
+    fprintf(f, "static const int16_t %s_data[%u] = {", name, n);
+    for(uint32_t i=0;i<n;i++)
+      fprintf(f, "%s%d", !i ? "\n  " : i % 12 ? ", " : ",\n  ", frames[i]);
+  } else
+  {
+    fprintf(f, "static const uint8_t %s_adpcm[%zu] = {", name, blocks.size());
+    for(size_t i=0;i<blocks.size();i++)
+      fprintf(f, "%s0x%02X", !i ? "\n  " : i % 16 ? "," : ",\n  ", blocks[i]);
+  }
+  fprintf(f, "\n};\n\n");
+  fprintf(f, "static const sample_t %s = {\n  %s, %u, %u, %u, %u, %d, %s\n};\n\n", name,
+          pcm ? (std::string(name) + "_data").c_str() : "NULL", n, loop_start, loop_end, rate_hz, root_note,
+          pcm ? "NULL" : (std::string(name) + "_adpcm").c_str());
+  fprintf(f, "#endif\n");
+  fclose(f);
+
+  size_t raw = (size_t)n * 2;
+  size_t packed = pcm ? raw : blocks.size();
+  printf("%s: %u frames at %u Hz, %zu -> %zu bytes (%.1f%%), ADPCM %.1f dB SNR%s\n", name, n, rate_hz,
+         raw, packed, 100.0 * packed / raw, snr, pcm ? ", kept as PCM" : "");
+  return 0;
+}
@@ -0,0 +1,220 @@
+// Host benchmark of the sampler voice engine (sampler.cpp).
+//
+// For each interpolation it times blocks with no voices, which
+// is the cost of clearing and saturating the mix, and with every voice
+// playing. The difference per voice against the block's real-time budget
+// gives the voices one core of this machine can sustain at the rate.
+//
+// "interp" is the RP2040 interpolator path; here it runs its portable
+// fallback, so it shows what the segmenting into unchecked runs saves and
+// what the 8-bit blend costs in noise. The interpolators themselves can only
+// be timed on the Pico (AUDIO_BENCH_AT_BOOT in defines.h).
+//
+// "adpcm" is the same test sample encoded as IMA-ADPCM (adpcm.h), which
+// voices decode as they play. It reports the frames each voice decodes per
+// frame it plays; more than one is a block decoded again after a jump back.
+//
+// It also plays a sine cycle at an awkward pitch and measures the
+// interpolation noise against an exact sine, and with -o writes a short
+// chord, for a listen.
+//
+//   sampler_bench [-b blocks] [-r rate] [-o chord.wav]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "audio_engine.h"
+#include "sampler.h"
+#include "defines.h"
+#include "wav_writer.h"
+#include "bench_clock.h"
+
+static const char *interp_name[] = { "linear", "cubic", "interp" };
+
+// A copy of a PCM sample, encoded as ADPCM.
+static sample_t to_adpcm(const sample_t *smp)
+{
+  sample_t a = *smp;
+  uint8_t *blocks = (uint8_t *)malloc(adpcm_bytes(smp->frames));
+  adpcm_encode(smp->data, smp->frames, blocks);
+  a.data = NULL;
+  a.adpcm = blocks;
+  return a;
+}
+
+// ns per block, best of three runs of n blocks
+static double time_blocks(uint32_t n, uint64_t *cycles)
+{
+  double best = 1e30;
+  uint64_t best_cyc = 0;
+  for(int run=0;run<3;run++)
+  {
+    uint64_t t0 = bench_ns();
+    uint64_t c0 = bench_cycles();
+    for(uint32_t b=0;b<n;b++)
+      audio_render_block();
+    uint64_t c = bench_cycles() - c0;
+    double ns = (double)(bench_ns() - t0) / n;
+    if(ns < best)
+    {
+      best = ns;
+      best_cyc = c / n;
+    }
+  }
+  if(cycles)
+    *cycles = best_cyc;
+  return best;
+}
+
+static void bench_voices(const char *name, const sample_t *smp, uint8_t interp, uint32_t rate, uint32_t blocks)
+{
+  audio_engine_init(rate);
+  audio_set_renderer(sampler_render, NULL);
+
+  sampler_init(SAMPLER_MAX_VOICES, interp);
+  double empty_ns = time_blocks(blocks, NULL);
+
+  // every voice on a different note, spread over four octaves, so the
+  // phase steps and loop wraps differ
+  for(int v=0;v<SAMPLER_MAX_VOICES;v++)
+    sampler_note_on(smp, 36 + v * 3 / 2, 100, v * 127 / (SAMPLER_MAX_VOICES - 1));
+  audio_render_block();   // past the attack ramp
+  uint64_t cyc;
+  uint32_t decoded = sampler_stats.decoded;
+  double full_ns = time_blocks(blocks, &cyc);
+  decoded = sampler_stats.decoded - decoded;
+
+  double budget_ns = 1e9 * AUDIO_BLOCK_FRAMES / rate;
+  double voice_ns = (full_ns - empty_ns) / SAMPLER_MAX_VOICES;
+  double frame_ns = voice_ns / AUDIO_BLOCK_FRAMES;
+  printf("  %-6s  %7.0f ns  %8.2f ns  %9.1f  %9.0f",
+         name, empty_ns, frame_ns,
+         (double)cyc / SAMPLER_MAX_VOICES / AUDIO_BLOCK_FRAMES,
+         (budget_ns - empty_ns) / voice_ns);
+  if(decoded)
+    printf("  %.2f decoded per frame", (double)decoded / (3.0 * blocks * SAMPLER_MAX_VOICES * AUDIO_BLOCK_FRAMES));
+  printf("\n");
+}
+
+// Plays a 64-frame sine cycle a fifth up, and compares the output with an
+// exact sine at the phase step actually used. Returns the signal to noise
+// ratio in dB.
+static double sine_snr(uint8_t interp, bool adpcm, uint32_t rate)
+{
+  static int16_t cyc[64];
+  for(int i=0;i<64;i++)
+    cyc[i] = (int16_t)lrint(30000 * sin(2 * M_PI * i / 64));
+  sample_t smp = { cyc, 64, 0, 64, 64 * 440, 69, NULL };
+  if(adpcm)
+    smp = to_adpcm(&smp);
+
+  audio_engine_init(rate);
+  audio_set_renderer(sampler_render, NULL);
+  sampler_init(1, interp);
+  sampler_note_on(&smp, 76, 127, 64);
+  uint32_t step = sampler_pitch_step(&smp, 76, rate);
+  audio_render_block();   // past the attack ramp
+
+  double sig = 0, err = 0, cross = 0, ref2 = 0;
+  static double ref[16 * AUDIO_BLOCK_FRAMES];
+  static int16_t out[16 * AUDIO_BLOCK_FRAMES];
+  for(int b=0;b<16;b++)
+  {
+    int16_t *blk = audio_render_block();
+    for(int i=0;i<AUDIO_BLOCK_FRAMES;i++)
+    {
+      uint32_t n = (b + 1) * AUDIO_BLOCK_FRAMES + i;
+      double pos = (double)n * step / (1 << SAMPLER_FRAC_BITS);
+      ref[b * AUDIO_BLOCK_FRAMES + i] = sin(2 * M_PI * pos / 64);
+      out[b * AUDIO_BLOCK_FRAMES + i] = blk[i * 2];
+    }
+  }
+  for(int i=0;i<16 * AUDIO_BLOCK_FRAMES;i++)
+  {
+    cross += out[i] * ref[i];
+    ref2 += ref[i] * ref[i];
+  }
+  double scale = cross / ref2;
+  for(int i=0;i<16 * AUDIO_BLOCK_FRAMES;i++)
+  {
+    double e = out[i] - scale * ref[i];
+    sig += scale * ref[i] * scale * ref[i];
+    err += e * e;
+  }
+  return 10 * log10(sig / (err ? err : 1e-9));
+}
+
+static bool write_chord(const char *path, uint32_t rate)
+{
+  wav_writer_t wav;
+  if(!wav_open(&wav, path, rate, AUDIO_CHANNELS))
+    return false;
+  audio_engine_init(rate);
+  audio_set_renderer(sampler_render, NULL);
+  sampler_init(AUDIO_VOICES, SAMPLER_CUBIC);
+  static const uint8_t chord[] = { 48, 55, 60, 64, 67, 72 };
+  uint32_t blocks = rate / AUDIO_BLOCK_FRAMES;    // about a second each
+  for(unsigned n=0;n<sizeof(chord);n++)
+  {
+    sampler_note_on(sampler_test_sample(), chord[n], 90, n * 127 / (sizeof(chord) - 1));
+    for(uint32_t b=0;b<blocks / 4;b++)
+      wav_write(&wav, audio_render_block(), AUDIO_BLOCK_FRAMES);
+  }
+  for(uint32_t b=0;b<blocks;b++)
+    wav_write(&wav, audio_render_block(), AUDIO_BLOCK_FRAMES);
+  sampler_all_off();
+  for(uint32_t b=0;b<blocks / 4;b++)
+    wav_write(&wav, audio_render_block(), AUDIO_BLOCK_FRAMES);
+  wav_close(&wav);
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  uint32_t blocks = 2000;
+  uint32_t rate = SAMPLE_RATE_HZ;
+  const char *wav_path = NULL;
+
+  for(int i=1;i<argc;i++)
+  {
+    if(!strcmp(argv[i], "-b") && i+1 < argc)
+      blocks = atoi(argv[++i]);
+    else if(!strcmp(argv[i], "-r") && i+1 < argc)
+      rate = atoi(argv[++i]);
+    else if(!strcmp(argv[i], "-o") && i+1 < argc)
+      wav_path = argv[++i];
+    else
+    {
+      fprintf(stderr, "usage: %s [-b blocks] [-r rate] [-o chord.wav]\n", argv[0]);
+      return 1;
+    }
+  }
+  if(!blocks)
+    blocks = 1;
+
+  printf("%d voices, blocks of %d frames at %u Hz (%.1f us each):\n",
+         SAMPLER_MAX_VOICES, AUDIO_BLOCK_FRAMES, rate, 1e6 * AUDIO_BLOCK_FRAMES / rate);
+  printf("  interp  mix/block  per voice  cycles per  voices per\n");
+  printf("          (no voice) and frame  voice frame  host core\n");
+  for(uint8_t interp=SAMPLER_LINEAR;interp<=SAMPLER_INTERP;interp++)
+    bench_voices(interp_name[interp], sampler_test_sample(), interp, rate, blocks);
+  sample_t adpcm = to_adpcm(sampler_test_sample());
+  bench_voices("adpcm", &adpcm, SAMPLER_LINEAR, rate, blocks);
+
+  printf("sine a fifth up, interpolation noise:\n");
+  for(uint8_t interp=SAMPLER_LINEAR;interp<=SAMPLER_INTERP;interp++)
+    printf("  %-6s  %.1f dB SNR\n", interp_name[interp], sine_snr(interp, false, rate));
+  printf("  %-6s  %.1f dB SNR\n", "adpcm", sine_snr(SAMPLER_LINEAR, true, rate));
+
+  if(wav_path)
+  {
+    if(!write_chord(wav_path, rate))
+    {
+      fprintf(stderr, "can't write %s\n", wav_path);
+      return 1;
+    }
+    printf("chord -> %s\n", wav_path);
+  }
+  return 0;
+}
@@ -0,0 +1,57 @@
+#ifndef __SIM_ARDUINO_H__
+#define __SIM_ARDUINO_H__
+
+// Host stand-in for the parts of the Arduino-Pico core the firmware uses.
+// Time is the host's monotonic clock since the simulator started, so
+// micros() and millis() run at real speed on both simulated cores.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <type_traits>
+
+typedef enum
+{
+  INPUT,
+  OUTPUT,
+  INPUT_PULLUP,
+  INPUT_PULLDOWN,
+} PinMode;
+
+typedef uint8_t pin_size_t;
+
+#define LOW           0
+#define HIGH          1
+#define LED_BUILTIN   25
+
+uint32_t micros(void);
+uint32_t millis(void);
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+
+static inline void pinMode(pin_size_t, PinMode) {}
+static inline void digitalWrite(pin_size_t, int) {}
+
+template <typename A, typename B>
+static inline typename std::common_type<A, B>::type min(A a, B b) { return a < b ? a : b; }
+template <typename A, typename B>
+static inline typename std::common_type<A, B>::type max(A a, B b) { return a > b ? a : b; }
+
+// Serial goes to stdout.
+class SerialUSB
+{
+public:
+  void begin(unsigned long) {}
+  size_t print(const char *s) { return fputs(s, stdout) < 0 ? 0 : strlen(s); }
+  size_t print(long v) { return printf("%ld", v); }
+  size_t println(const char *s) { return printf("%s\n", s); }
+  size_t println(long v) { return printf("%ld\n", v); }
+  size_t printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+};
+
+extern SerialUSB Serial;
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef __SIM_I2S_H__
+#define __SIM_I2S_H__
+
+// Host stand-in for the Arduino-Pico I2S output. The DMA buffers drain in
+// real time at the sample rate, and everything that plays is written to a
+// WAV file, if one was given with i2s_sim_open_wav() before begin(). A
+// buffer that comes due with nothing written is an underrun: it plays
+// silence, is counted, and sets the flag getUnderflow() reports.
+//
+// write() blocks while all the buffers are full, as the real one does.
+
+#include <stdint.h>
+#include <stddef.h>
+#include "Arduino.h"
+
+typedef struct
+{
+  uint32_t buffers_played;
+  uint32_t underruns;
+  uint32_t rate_changes;
+} i2s_sim_stats_t;
+
+extern i2s_sim_stats_t i2s_sim_stats;
+
+void i2s_sim_open_wav(const char *path);
+void i2s_sim_close(void);
+
+class I2S
+{
+public:
+  I2S(PinMode direction);
+
+  bool setBCLK(pin_size_t) { return true; }
+  bool setDATA(pin_size_t) { return true; }
+  bool setMCLK(pin_size_t) { return true; }
+  bool setMCLKmult(int) { return true; }
+  bool setBitsPerSample(int bps);
+  bool setBuffers(size_t buffers, size_t bufferWords, int32_t silenceSample = 0);
+  bool setFrequency(int newFreq);
+  bool begin(long sampleRate);
+  bool begin(void);
+  void end(void);
+
+  size_t write(const uint8_t *buffer, size_t size);
+  int availableForWrite(void);
+  bool getUnderflow(void);
+
+private:
+  uint32_t rate = 48000;
+  size_t nbuf = 6;
+  size_t words = 16;
+  uint8_t bits = 16;
+  bool running = false;
+  bool underflow = false;
+  size_t filled = 0;        // whole buffers waiting to play
+  size_t partial = 0;       // bytes of the buffer being filled
+  uint8_t *fill_buf = NULL;
+  uint64_t next_due_ns;     // when the playing buffer finishes
+  void advance(void);
+  uint64_t buffer_ns(void);
+};
+
+#endif
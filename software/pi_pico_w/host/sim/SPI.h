@@ -0,0 +1,6 @@
+#ifndef __SIM_SPI_H__
+#define __SIM_SPI_H__
+
+// Host stand-in. The display's SPI traffic is modelled by TFT_eSPI.h.
+
+#endif
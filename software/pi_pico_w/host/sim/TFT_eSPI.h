@@ -0,0 +1,93 @@
+#ifndef __SIM_TFT_ESPI_H__
+#define __SIM_TFT_ESPI_H__
+
+// Host stand-in for Bodmer's TFT_eSPI, driving an ILI9486 the way the real
+// library does: every address window is a CASET, PASET and RAMWR sequence,
+// drawChar() at text size 2 is one fillRect() per font pixel, and so on.
+// Pixels land in tft_sim_fb, a 480x320 RGB565 framebuffer, and every
+// command and data byte is counted, so the cost of a redraw can be read
+// off as SPI time. Every transfer also blocks for its SPI time, so loop()
+// runs at the pace the display allows.
+//
+// The panel is a Raspberry Pi style display, which takes everything as
+// 16-bit SPI words: each command and each parameter byte costs two bytes
+// on the wire, the same as a pixel.
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define TFT_BLACK       0x0000
+#define TFT_NAVY        0x000F
+#define TFT_DARKGREEN   0x03E0
+#define TFT_RED         0xF800
+#define TFT_GREEN       0x07E0
+#define TFT_BLUE        0x001F
+#define TFT_YELLOW      0xFFE0
+#define TFT_ORANGE      0xFDA0
+#define TFT_WHITE       0xFFFF
+
+#define TFT_SIM_W       480
+#define TFT_SIM_H       320
+#define TFT_SIM_SPI_HZ  27000000    // SPI_FREQUENCY in User_Setup.h
+#define TFT_SIM_INIT_WAIT_MS 125    // delays inside init()
+
+typedef struct
+{
+  uint32_t commands;        // command words
+  uint32_t data_bytes;      // bytes after commands, parameters and pixels
+  uint32_t windows;         // address windows set up
+  uint32_t pixels;
+  uint32_t chars;           // drawChar() calls
+} tft_sim_stats_t;
+
+extern tft_sim_stats_t tft_sim_stats;
+extern uint16_t tft_sim_fb[TFT_SIM_H][TFT_SIM_W];
+
+// SPI time of everything counted so far, in microseconds
+double tft_sim_spi_us(void);
+bool tft_sim_save_ppm(const char *path);
+
+class TFT_eSPI
+{
+public:
+  TFT_eSPI(int16_t w = TFT_SIM_H, int16_t h = TFT_SIM_W);
+
+  void init(void);
+  void setRotation(uint8_t r);
+  int16_t width(void) { return _width; }
+  int16_t height(void) { return _height; }
+
+  void fillScreen(uint32_t color);
+  void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void drawPixel(int32_t x, int32_t y, uint32_t color);
+  void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color);
+  void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color);
+
+  void setTextSize(uint8_t s) { textsize = s ? s : 1; }
+  void setTextColor(uint16_t c) { textcolor = textbgcolor = c; }
+  void setTextColor(uint16_t c, uint16_t b) { textcolor = c; textbgcolor = b; }
+  void setCursor(int16_t x, int16_t y) { cursor_x = x; cursor_y = y; }
+  size_t print(const char *s);
+  void drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size);
+
+  void setSwapBytes(bool swap) { _swapBytes = swap; }
+  bool getSwapBytes(void) { return _swapBytes; }
+  void startWrite(void) {}
+  void endWrite(void) {}
+  void setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h);
+  void pushPixels(const void *data, uint32_t len);
+  void pushColor(uint16_t color, uint32_t len);
+
+private:
+  int16_t _width, _height;
+  int16_t cursor_x = 0, cursor_y = 0;
+  uint8_t textsize = 1;
+  uint16_t textcolor = TFT_WHITE, textbgcolor = TFT_WHITE;
+  bool _swapBytes = false;
+  int32_t win_x0 = 0, win_y0 = 0, win_x1 = 0, win_y1 = 0;   // inclusive
+  int32_t win_x = 0, win_y = 0;                             // next pixel
+  void command(uint8_t n_params);
+  void put(uint16_t color);
+};
+
+#endif
@@ -0,0 +1,112 @@
+#ifndef __SIM_WIRE_H__
+#define __SIM_WIRE_H__
+
+// Host stand-in for the Arduino-Pico Wire library.
+//
+// As a master (Wire1, the codec bus), transfers go to device models
+// attached with wire_sim_attach(). The library's quirks are kept: only
+// endTransmission() sends what write() buffered, so a requestFrom() between
+// the two reads from wherever the device was already pointing.
+//
+// As a slave (Wire, the keyboard bus), wire_sim_poll() plays back frames
+// recorded from the keyboard controller through the onReceive callback, and
+// reads the LED frame through onRequest once per controller LED cycle, as
+// the controller would. See wire_sim_load().
+//
+// Every transfer is counted, with the bus time it would take at the set
+// clock. Master transfers block for that long, as they do on the Pico; a
+// slave's traffic is the interrupt's business and costs the loop nothing.
+
+#include <stdint.h>
+#include <stddef.h>
+#include "Arduino.h"
+
+#define WIRE_BUFFER_LEN   128
+
+// A device on a master bus. write() gets each write transfer's bytes, and
+// read() fills a read transfer. Either returns false to NACK.
+typedef struct
+{
+  bool (*write)(void *ctx, const uint8_t *data, size_t len);
+  bool (*read)(void *ctx, uint8_t *data, size_t len);
+  void *ctx;
+} wire_sim_device_t;
+
+typedef struct
+{
+  uint32_t writes;          // write transfers
+  uint32_t reads;           // read transfers
+  uint32_t bytes;           // bytes on the bus, address bytes included
+  uint32_t nacks;
+  double   bus_us;          // time the bus was busy
+} wire_sim_stats_t;
+
+class TwoWire
+{
+public:
+  TwoWire(const char *name) : name(name) {}
+
+  bool setSDA(pin_size_t) { return true; }
+  bool setSCL(pin_size_t) { return true; }
+  void setClock(uint32_t hz) { clock_hz = hz; }
+  void begin(void) { slave = false; }
+  void begin(uint8_t addr) { slave = true; own_addr = addr; }
+  void end(void) {}
+
+  void onReceive(void (*fn)(int)) { on_receive = fn; }
+  void onRequest(void (*fn)(void)) { on_request = fn; }
+
+  void beginTransmission(uint8_t addr);
+  uint8_t endTransmission(bool stop = true);
+  size_t requestFrom(uint8_t addr, size_t quantity, bool stop = true);
+
+  size_t write(uint8_t data);
+  size_t write(const uint8_t *data, size_t quantity);
+  int available(void) { return (int)(rx_len - rx_pos); }
+  int read(void) { return rx_pos < rx_len ? rx_buf[rx_pos++] : -1; }
+
+  const char *name;
+  wire_sim_stats_t stats = {};
+  wire_sim_device_t *devices[128] = {};
+
+  // used by the simulator to play the master's part on a slave bus
+  void (*on_receive)(int) = NULL;
+  void (*on_request)(void) = NULL;
+  uint8_t rx_buf[WIRE_BUFFER_LEN];
+  size_t rx_len = 0, rx_pos = 0;
+  uint8_t tx_buf[WIRE_BUFFER_LEN];
+  size_t tx_len = 0;
+  uint32_t clock_hz = 100000;
+  void count(size_t bytes);    // a transfer of 'bytes', address included
+
+private:
+  bool slave = false;
+  uint8_t own_addr = 0;
+  uint8_t tx_addr = 0;
+};
+
+extern TwoWire Wire;
+extern TwoWire Wire1;
+
+void wire_sim_attach(TwoWire &bus, uint8_t addr, wire_sim_device_t *dev);
+
+// Keyboard frame playback. A recording is text, one frame per line: the
+// controller's send time in microseconds, then the frame bytes in hex.
+// Lines starting with '#' are comments. host/kb_bench in the
+// atmega328p_keys_and_leds folder writes these with -w.
+typedef struct
+{
+  uint32_t frames;          // frames delivered to onReceive
+  uint32_t led_reads;       // onRequest calls
+  uint32_t led_bytes;       // bytes the firmware wrote back for them
+} wire_sim_replay_stats_t;
+
+extern wire_sim_replay_stats_t wire_sim_replay_stats;
+
+bool wire_sim_load(const char *path);
+// Delivers everything due by 'us' after playback started, on the calling
+// thread. Call it between passes of loop(), where an interrupt could land.
+void wire_sim_poll(uint32_t us);
+bool wire_sim_replay_done(void);
+
+#endif
@@ -0,0 +1,56 @@
+#include <stdarg.h>
+#include <chrono>
+#include <thread>
+#include "Arduino.h"
+#include "sim_clock.h"
+
+SerialUSB Serial;
+
+static const std::chrono::steady_clock::time_point t_start = std::chrono::steady_clock::now();
+
+uint32_t micros(void)
+{
+  return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - t_start).count();
+}
+
+uint32_t millis(void)
+{
+  return micros() / 1000;
+}
+
+void delay(uint32_t ms)
+{
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(uint32_t us)
+{
+  std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+size_t SerialUSB::printf(const char *fmt, ...)
+{
+  va_list ap;
+  va_start(ap, fmt);
+  int n = vprintf(fmt, ap);
+  va_end(ap);
+  return n < 0 ? 0 : n;
+}
+
+// Each thread keeps its own debt of bus time; see sim_clock.h.
+void sim_busy_us(double us)
+{
+  static thread_local double owed_us = 0;
+  static thread_local std::chrono::steady_clock::time_point since;
+  auto now = std::chrono::steady_clock::now();
+  if(owed_us <= 0)
+    since = now;
+  owed_us += us;
+  if(owed_us < SIM_BUSY_SLACK_US)
+    return;
+  auto until = since + std::chrono::nanoseconds((int64_t)(owed_us * 1000));
+  while(std::chrono::steady_clock::now() < until)
+    ;
+  owed_us = 0;
+}
@@ -0,0 +1,7 @@
+#ifndef __SIM_HARDWARE_PWM_H__
+#define __SIM_HARDWARE_PWM_H__
+
+// Host stand-in for the Pico SDK PWM header. The firmware includes it for
+// the (disabled) MCLK-from-PWM code, and uses none of it.
+
+#endif
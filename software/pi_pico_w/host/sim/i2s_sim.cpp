@@ -0,0 +1,164 @@
+#include <chrono>
+#include <thread>
+#include "I2S.h"
+#include "wav_writer.h"
+
+i2s_sim_stats_t i2s_sim_stats;
+
+static const char *wav_path = NULL;
+static wav_writer_t wav;
+static bool wav_is_open = false;
+
+static uint64_t now_ns(void)
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void i2s_sim_open_wav(const char *path)
+{
+  wav_path = path;
+}
+
+void i2s_sim_close(void)
+{
+  if(wav_is_open)
+    wav_close(&wav);
+  wav_is_open = false;
+}
+
+I2S::I2S(PinMode)
+{
+}
+
+bool I2S::setBitsPerSample(int bps)
+{
+  if(bps != 16)
+    return false;   // the WAV output only does 16-bit stereo
+  bits = bps;
+  return true;
+}
+
+bool I2S::setBuffers(size_t buffers, size_t bufferWords, int32_t)
+{
+  if(running || buffers < 2 || !bufferWords)
+    return false;
+  nbuf = buffers;
+  words = bufferWords;
+  return true;
+}
+
+uint64_t I2S::buffer_ns(void)
+{
+  return (uint64_t)words * 1000000000ull / rate;
+}
+
+bool I2S::begin(long sampleRate)
+{
+  rate = sampleRate;
+  return begin();
+}
+
+bool I2S::begin(void)
+{
+  if(running)
+    return false;
+  fill_buf = (uint8_t *)calloc(words, 4);
+  if(!fill_buf)
+    return false;
+  if(wav_path && !wav_is_open)
+    wav_is_open = wav_open(&wav, wav_path, rate, 2);
+  filled = partial = 0;
+  underflow = false;
+  next_due_ns = now_ns() + buffer_ns();
+  running = true;
+  return true;
+}
+
+void I2S::end(void)
+{
+  running = false;
+  free(fill_buf);
+  fill_buf = NULL;
+}
+
+// Plays out every buffer whose time has come.
+void I2S::advance(void)
+{
+  uint64_t now = now_ns();
+  while(now >= next_due_ns)
+  {
+    if(filled)
+      filled--;
+    else
+    {
+      underflow = true;
+      i2s_sim_stats.underruns++;
+      if(wav_is_open)
+      {
+        static const int16_t silence[2 * 64] = {0};
+        for(size_t n=0;n<words;n+=64)
+          wav_write(&wav, silence, words - n < 64 ? words - n : 64);
+      }
+    }
+    i2s_sim_stats.buffers_played++;
+    next_due_ns += buffer_ns();
+  }
+}
+
+bool I2S::setFrequency(int newFreq)
+{
+  if(newFreq <= 0)
+    return false;
+  if(running)
+  {
+    advance();
+    next_due_ns = now_ns() + buffer_ns();
+  }
+  if((uint32_t)newFreq != rate)
+    i2s_sim_stats.rate_changes++;
+  rate = newFreq;
+  return true;
+}
+
+int I2S::availableForWrite(void)
+{
+  if(!running)
+    return 0;
+  advance();
+  return (int)((nbuf - filled) * words * 4 - partial);
+}
+
+size_t I2S::write(const uint8_t *buffer, size_t size)
+{
+  if(!running)
+    return 0;
+  advance();
+  while(filled == nbuf)
+  {
+    int64_t wait = (int64_t)(next_due_ns - now_ns());
+    std::this_thread::sleep_for(std::chrono::nanoseconds(wait > 0 ? wait + 1000 : 1000));
+    advance();
+  }
+  size_t room = words * 4 - partial;
+  size_t n = size < room ? size : room;
+  memcpy(fill_buf + partial, buffer, n);
+  partial += n;
+  if(partial == words * 4)
+  {
+    if(wav_is_open)
+      wav_write(&wav, (const int16_t *)fill_buf, words);
+    partial = 0;
+    filled++;
+  }
+  return n;
+}
+
+bool I2S::getUnderflow(void)
+{
+  if(running)
+    advance();
+  bool u = underflow;
+  underflow = false;
+  return u;
+}
@@ -0,0 +1,50 @@
+#include <string.h>
+#include "Arduino.h"
+#include "nau8822_sim.h"
+
+nau8822_sim_t nau8822_sim;
+
+static bool codec_write(void *ctx, const uint8_t *data, size_t len)
+{
+  nau8822_sim_t *c = (nau8822_sim_t *)ctx;
+  if(!len)
+    return true;
+  c->ptr = data[0] >> 1;
+  if(len == 1)
+  {
+    c->pointer_writes++;
+    return true;
+  }
+  uint16_t v = ((data[0] & 1) << 8) | data[1];
+  if(c->ptr == 0)
+  {
+    memset(c->regs, 0, sizeof(c->regs));
+    c->resets++;
+    c->reset_us = micros();
+  } else
+  {
+    c->regs[c->ptr] = v;
+    if(c->resets && micros() - c->reset_us < NAU8822_SIM_SETTLE_US)
+      c->early_writes++;
+  }
+  c->writes++;
+  c->extra_bytes += len - 2;
+  return true;
+}
+
+static bool codec_read(void *ctx, uint8_t *data, size_t len)
+{
+  nau8822_sim_t *c = (nau8822_sim_t *)ctx;
+  uint16_t v = c->regs[c->ptr & 63];
+  for(size_t i=0;i<len;i++)
+    data[i] = i == 0 ? v >> 8 : i == 1 ? v & 0xFF : 0xFF;
+  c->reads++;
+  return true;
+}
+
+static wire_sim_device_t codec_dev = { codec_write, codec_read, &nau8822_sim };
+
+void nau8822_sim_attach(TwoWire &bus, uint8_t addr)
+{
+  wire_sim_attach(bus, addr, &codec_dev);
+}
@@ -0,0 +1,35 @@
+#ifndef __NAU8822_SIM_H__
+#define __NAU8822_SIM_H__
+
+#include <stdint.h>
+#include "Wire.h"
+
+// Register model of the NAU8822 codec on a simulated I2C bus.
+//
+// A register write is two bytes: the register address in bits 7..1 of the
+// first, with data bit 8 in bit 0, then data bits 7..0. A one-byte write
+// only points at a register, for a read that follows, which returns its
+// nine bits as two bytes. Bytes past the second are counted and ignored.
+// Writes sooner than NAU8822_SIM_SETTLE_US after a reset are counted as
+// early; the real part may not have taken them.
+
+#define NAU8822_SIM_SETTLE_US 1000
+
+typedef struct
+{
+  uint16_t regs[64];
+  uint8_t  ptr;             // register the next read returns
+  uint32_t writes;          // registers written
+  uint32_t pointer_writes;  // one-byte writes
+  uint32_t extra_bytes;     // bytes past the second of a write
+  uint32_t reads;
+  uint32_t resets;          // writes to register 0
+  uint32_t early_writes;    // register writes while settling from a reset
+  uint32_t reset_us;        // micros() at the last reset
+} nau8822_sim_t;
+
+extern nau8822_sim_t nau8822_sim;
+
+void nau8822_sim_attach(TwoWire &bus, uint8_t addr);
+
+#endif
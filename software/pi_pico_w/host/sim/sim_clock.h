@@ -0,0 +1,14 @@
+#ifndef __SIM_CLOCK_H__
+#define __SIM_CLOCK_H__
+
+// Blocking transfers in the stand-ins (display SPI, master I2C) take as
+// long on the host as they would on the Pico: each one calls sim_busy_us()
+// with its bus time, and the calling thread spins until it has passed.
+// Short transfers are run together, so timing stays within about
+// SIM_BUSY_SLACK_US without a clock read per byte.
+
+#define SIM_BUSY_SLACK_US   20
+
+void sim_busy_us(double us);
+
+#endif
@@ -0,0 +1,237 @@
+#include <stdio.h>
+#include <string.h>
+#include "Arduino.h"
+#include "TFT_eSPI.h"
+#include "sim_clock.h"
+
+tft_sim_stats_t tft_sim_stats;
+uint16_t tft_sim_fb[TFT_SIM_H][TFT_SIM_W];
+
+// bytes per command or parameter on the wire; see TFT_eSPI.h
+#define WIRE_BYTES  2
+
+// The classic 5x7 GLCD font, printable ASCII. One byte per column, bit 0
+// at the top.
+static const uint8_t glcd_font[95][5] =
+{
+  {0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x5F,0x00,0x00}, {0x00,0x07,0x00,0x07,0x00}, {0x14,0x7F,0x14,0x7F,0x14},
+  {0x24,0x2A,0x7F,0x2A,0x12}, {0x23,0x13,0x08,0x64,0x62}, {0x36,0x49,0x56,0x20,0x50}, {0x00,0x08,0x07,0x03,0x00},
+  {0x00,0x1C,0x22,0x41,0x00}, {0x00,0x41,0x22,0x1C,0x00}, {0x2A,0x1C,0x7F,0x1C,0x2A}, {0x08,0x08,0x3E,0x08,0x08},
+  {0x00,0x80,0x70,0x30,0x00}, {0x08,0x08,0x08,0x08,0x08}, {0x00,0x00,0x60,0x60,0x00}, {0x20,0x10,0x08,0x04,0x02},
+  {0x3E,0x51,0x49,0x45,0x3E}, {0x00,0x42,0x7F,0x40,0x00}, {0x72,0x49,0x49,0x49,0x46}, {0x21,0x41,0x49,0x4D,0x33},
+  {0x18,0x14,0x12,0x7F,0x10}, {0x27,0x45,0x45,0x45,0x39}, {0x3C,0x4A,0x49,0x49,0x31}, {0x41,0x21,0x11,0x09,0x07},
+  {0x36,0x49,0x49,0x49,0x36}, {0x46,0x49,0x49,0x29,0x1E}, {0x00,0x00,0x14,0x00,0x00}, {0x00,0x40,0x34,0x00,0x00},
+  {0x00,0x08,0x14,0x22,0x41}, {0x14,0x14,0x14,0x14,0x14}, {0x00,0x41,0x22,0x14,0x08}, {0x02,0x01,0x59,0x09,0x06},
+  {0x3E,0x41,0x5D,0x59,0x4E}, {0x7C,0x12,0x11,0x12,0x7C}, {0x7F,0x49,0x49,0x49,0x36}, {0x3E,0x41,0x41,0x41,0x22},
+  {0x7F,0x41,0x41,0x41,0x3E}, {0x7F,0x49,0x49,0x49,0x41}, {0x7F,0x09,0x09,0x09,0x01}, {0x3E,0x41,0x41,0x51,0x73},
+  {0x7F,0x08,0x08,0x08,0x7F}, {0x00,0x41,0x7F,0x41,0x00}, {0x20,0x40,0x41,0x3F,0x01}, {0x7F,0x08,0x14,0x22,0x41},
+  {0x7F,0x40,0x40,0x40,0x40}, {0x7F,0x02,0x1C,0x02,0x7F}, {0x7F,0x04,0x08,0x10,0x7F}, {0x3E,0x41,0x41,0x41,0x3E},
+  {0x7F,0x09,0x09,0x09,0x06}, {0x3E,0x41,0x51,0x21,0x5E}, {0x7F,0x09,0x19,0x29,0x46}, {0x26,0x49,0x49,0x49,0x32},
+  {0x03,0x01,0x7F,0x01,0x03}, {0x3F,0x40,0x40,0x40,0x3F}, {0x1F,0x20,0x40,0x20,0x1F}, {0x3F,0x40,0x38,0x40,0x3F},
+  {0x63,0x14,0x08,0x14,0x63}, {0x03,0x04,0x78,0x04,0x03}, {0x61,0x59,0x49,0x4D,0x43}, {0x00,0x7F,0x41,0x41,0x41},
+  {0x02,0x04,0x08,0x10,0x20}, {0x00,0x41,0x41,0x41,0x7F}, {0x04,0x02,0x01,0x02,0x04}, {0x40,0x40,0x40,0x40,0x40},
+  {0x00,0x03,0x07,0x08,0x00}, {0x20,0x54,0x54,0x78,0x40}, {0x7F,0x28,0x44,0x44,0x38}, {0x38,0x44,0x44,0x44,0x28},
+  {0x38,0x44,0x44,0x28,0x7F}, {0x38,0x54,0x54,0x54,0x18}, {0x00,0x08,0x7E,0x09,0x02}, {0x18,0xA4,0xA4,0x9C,0x78},
+  {0x7F,0x08,0x04,0x04,0x78}, {0x00,0x44,0x7D,0x40,0x00}, {0x20,0x40,0x40,0x3D,0x00}, {0x7F,0x10,0x28,0x44,0x00},
+  {0x00,0x41,0x7F,0x40,0x00}, {0x7C,0x04,0x78,0x04,0x78}, {0x7C,0x08,0x04,0x04,0x78}, {0x38,0x44,0x44,0x44,0x38},
+  {0xFC,0x18,0x24,0x24,0x18}, {0x18,0x24,0x24,0x18,0xFC}, {0x7C,0x08,0x04,0x04,0x08}, {0x48,0x54,0x54,0x54,0x24},
+  {0x04,0x04,0x3F,0x44,0x24}, {0x3C,0x40,0x40,0x20,0x7C}, {0x1C,0x20,0x40,0x20,0x1C}, {0x3C,0x40,0x30,0x40,0x3C},
+  {0x44,0x28,0x10,0x28,0x44}, {0x4C,0x90,0x90,0x90,0x7C}, {0x44,0x64,0x54,0x4C,0x44}, {0x00,0x08,0x36,0x41,0x00},
+  {0x00,0x00,0x77,0x00,0x00}, {0x00,0x41,0x36,0x08,0x00}, {0x02,0x01,0x02,0x04,0x02},
+};
+
+double tft_sim_spi_us(void)
+{
+  double bytes = (double)tft_sim_stats.commands * WIRE_BYTES + tft_sim_stats.data_bytes;
+  return bytes * 8 * 1e6 / TFT_SIM_SPI_HZ;
+}
+
+bool tft_sim_save_ppm(const char *path)
+{
+  FILE *f = fopen(path, "wb");
+  if(!f)
+    return false;
+  fprintf(f, "P6\n%d %d\n255\n", TFT_SIM_W, TFT_SIM_H);
+  for(int y=0;y<TFT_SIM_H;y++)
+  {
+    for(int x=0;x<TFT_SIM_W;x++)
+    {
+      uint16_t c = tft_sim_fb[y][x];
+      uint8_t rgb[3] = { (uint8_t)((c >> 11) * 255 / 31), (uint8_t)(((c >> 5) & 63) * 255 / 63),
+                         (uint8_t)((c & 31) * 255 / 31) };
+      fwrite(rgb, 1, 3, f);
+    }
+  }
+  return fclose(f) == 0;
+}
+
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h)
+{
+  _width = w;
+  _height = h;
+}
+
+static void spi_time(uint32_t bytes)
+{
+  sim_busy_us(bytes * 8 * 1e6 / TFT_SIM_SPI_HZ);
+}
+
+void TFT_eSPI::command(uint8_t n_params)
+{
+  tft_sim_stats.commands++;
+  tft_sim_stats.data_bytes += n_params * WIRE_BYTES;
+  spi_time((1 + n_params) * WIRE_BYTES);
+}
+
+void TFT_eSPI::init(void)
+{
+  // the ILI9486 init sequence is about two dozen commands and 60 parameters,
+  // with waits after the reset and the sleep-out that come to about 125 ms
+  delay(TFT_SIM_INIT_WAIT_MS);
+  for(int i=0;i<24;i++)
+    command(i < 12 ? 4 : 1);
+  memset(tft_sim_fb, 0, sizeof(tft_sim_fb));
+}
+
+void TFT_eSPI::setRotation(uint8_t r)
+{
+  command(1);   // MADCTL
+  bool landscape = r & 1;
+  _width = landscape ? TFT_SIM_W : TFT_SIM_H;
+  _height = landscape ? TFT_SIM_H : TFT_SIM_W;
+}
+
+// CASET and PASET with four parameter bytes each, then RAMWR
+void TFT_eSPI::setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  command(4);
+  command(4);
+  command(0);
+  tft_sim_stats.windows++;
+  win_x0 = win_x = x;
+  win_y0 = win_y = y;
+  win_x1 = x + w - 1;
+  win_y1 = y + h - 1;
+}
+
+// One pixel into the window, wrapping to its next row. Pixels outside the
+// panel are clocked out but land nowhere.
+void TFT_eSPI::put(uint16_t color)
+{
+  if(win_x >= 0 && win_y >= 0 && win_x < TFT_SIM_W && win_y < TFT_SIM_H)
+    tft_sim_fb[win_y][win_x] = color;
+  if(++win_x > win_x1)
+  {
+    win_x = win_x0;
+    if(++win_y > win_y1)
+      win_y = win_y0;
+  }
+}
+
+void TFT_eSPI::pushPixels(const void *data, uint32_t len)
+{
+  const uint16_t *p = (const uint16_t *)data;
+  tft_sim_stats.pixels += len;
+  tft_sim_stats.data_bytes += len * 2;
+  // without the swap, a native uint16 goes out low byte first, and the
+  // panel reads it backwards
+  for(uint32_t i=0;i<len;i++)
+    put(_swapBytes ? p[i] : (uint16_t)((p[i] >> 8) | (p[i] << 8)));
+  spi_time(len * 2);
+}
+
+void TFT_eSPI::pushColor(uint16_t color, uint32_t len)
+{
+  tft_sim_stats.pixels += len;
+  tft_sim_stats.data_bytes += len * 2;
+  for(uint32_t i=0;i<len;i++)
+    put(color);
+  spi_time(len * 2);
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+  if(x < 0) { w += x; x = 0; }
+  if(y < 0) { h += y; y = 0; }
+  if(x + w > _width) w = _width - x;
+  if(y + h > _height) h = _height - y;
+  if(w <= 0 || h <= 0)
+    return;
+  setAddrWindow(x, y, w, h);
+  pushColor(color, (uint32_t)w * h);
+}
+
+void TFT_eSPI::fillScreen(uint32_t color)
+{
+  fillRect(0, 0, _width, _height, color);
+}
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color)
+{
+  fillRect(x, y, 1, 1, color);
+}
+
+void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color)
+{
+  fillRect(x, y, w, 1, color);
+}
+
+void TFT_eSPI::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color)
+{
+  fillRect(x, y, 1, h, color);
+}
+
+// As the library does it for the GLCD font: an opaque size 1 glyph is one
+// 6x8 window, anything else is drawn a font pixel at a time.
+void TFT_eSPI::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size)
+{
+  if(x >= _width || y >= _height || x + 6 * size <= 0 || y + 8 * size <= 0)
+    return;
+  tft_sim_stats.chars++;
+  const uint8_t *glyph = (c >= 32 && c < 127) ? glcd_font[c - 32] : glcd_font[0];
+  bool fillbg = bg != color;
+  if(size == 1 && fillbg)
+  {
+    setAddrWindow(x, y, 6, 8);
+    tft_sim_stats.pixels += 48;
+    tft_sim_stats.data_bytes += 48 * 2;
+    for(int j=0;j<8;j++)
+      for(int i=0;i<6;i++)
+        put((i < 5 && (glyph[i] >> j) & 1) ? color : bg);
+    spi_time(48 * 2);
+    return;
+  }
+  for(int i=0;i<6;i++)
+  {
+    uint8_t line = i < 5 ? glyph[i] : 0;
+    for(int j=0;j<8;j++, line>>=1)
+    {
+      if(line & 1)
+        fillRect(x + i * size, y + j * size, size, size, color);
+      else if(fillbg)
+        fillRect(x + i * size, y + j * size, size, size, bg);
+    }
+  }
+}
+
+size_t TFT_eSPI::print(const char *s)
+{
+  size_t n = 0;
+  for(;*s;s++, n++)
+  {
+    if(*s == '\n')
+    {
+      cursor_x = 0;
+      cursor_y += 8 * textsize;
+      continue;
+    }
+    if(cursor_x + 6 * textsize > _width)
+    {
+      cursor_x = 0;
+      cursor_y += 8 * textsize;
+    }
+    drawChar(cursor_x, cursor_y, *s, textcolor, textbgcolor, textsize);
+    cursor_x += 6 * textsize;
+  }
+  return n;
+}
@@ -0,0 +1,162 @@
+#include <vector>
+#include "Wire.h"
+#include "sim_clock.h"
+
+TwoWire Wire("kb");
+TwoWire Wire1("codec");
+
+wire_sim_replay_stats_t wire_sim_replay_stats;
+
+// The keyboard controller reads its LED frame once per LED refresh cycle:
+// six rows at one row per 1 ms scan.
+#define LED_POLL_US   6000
+
+typedef struct
+{
+  uint32_t t_us;
+  std::vector<uint8_t> data;
+} recorded_frame_t;
+
+static std::vector<recorded_frame_t> frames;
+static size_t next_frame = 0;
+static uint32_t next_led_poll_us = LED_POLL_US;
+
+void wire_sim_attach(TwoWire &bus, uint8_t addr, wire_sim_device_t *dev)
+{
+  bus.devices[addr & 0x7F] = dev;
+}
+
+// START, the bytes with their ACK bits, and a STOP or repeated START
+void TwoWire::count(size_t bytes)
+{
+  double us = (9.0 * bytes + 2) * 1e6 / clock_hz;
+  stats.bytes += bytes;
+  stats.bus_us += us;
+  if(!slave)
+    sim_busy_us(us);    // the master waits for its transfers
+}
+
+void TwoWire::beginTransmission(uint8_t addr)
+{
+  tx_addr = addr;
+  tx_len = 0;
+}
+
+size_t TwoWire::write(uint8_t data)
+{
+  return write(&data, 1);
+}
+
+size_t TwoWire::write(const uint8_t *data, size_t quantity)
+{
+  size_t n = 0;
+  for(;n<quantity && tx_len<WIRE_BUFFER_LEN;n++)
+    tx_buf[tx_len++] = data[n];
+  return n;
+}
+
+uint8_t TwoWire::endTransmission(bool stop)
+{
+  (void)stop;
+  count(1 + tx_len);
+  stats.writes++;
+  wire_sim_device_t *dev = devices[tx_addr & 0x7F];
+  bool ack = dev && dev->write && dev->write(dev->ctx, tx_buf, tx_len);
+  tx_len = 0;
+  if(!ack)
+  {
+    stats.nacks++;
+    return 2;   // address NACK, as the library reports it
+  }
+  return 0;
+}
+
+size_t TwoWire::requestFrom(uint8_t addr, size_t quantity, bool stop)
+{
+  (void)stop;
+  if(quantity > WIRE_BUFFER_LEN)
+    quantity = WIRE_BUFFER_LEN;
+  count(1 + quantity);
+  stats.reads++;
+  rx_len = rx_pos = 0;
+  wire_sim_device_t *dev = devices[addr & 0x7F];
+  if(!dev || !dev->read || !dev->read(dev->ctx, rx_buf, quantity))
+  {
+    stats.nacks++;
+    return 0;
+  }
+  rx_len = quantity;
+  return quantity;
+}
+
+bool wire_sim_load(const char *path)
+{
+  FILE *f = fopen(path, "r");
+  if(!f)
+    return false;
+  char line[512];
+  while(fgets(line, sizeof(line), f))
+  {
+    if(line[0] == '#')
+      continue;
+    char *p = line;
+    char *end;
+    unsigned long t = strtoul(p, &end, 10);
+    if(end == p)
+      continue;
+    recorded_frame_t fr;
+    fr.t_us = t;
+    for(p=end;;p=end)
+    {
+      unsigned long b = strtoul(p, &end, 16);
+      if(end == p)
+        break;
+      fr.data.push_back((uint8_t)b);
+    }
+    if(!fr.data.empty() && fr.data.size() <= WIRE_BUFFER_LEN)
+      frames.push_back(fr);
+  }
+  fclose(f);
+  next_frame = 0;
+  return true;
+}
+
+bool wire_sim_replay_done(void)
+{
+  return next_frame >= frames.size();
+}
+
+void wire_sim_poll(uint32_t us)
+{
+  TwoWire &bus = Wire;
+  for(;;)
+  {
+    bool frame_due = next_frame < frames.size() && frames[next_frame].t_us <= us;
+    bool poll_due = next_led_poll_us <= us;
+    if(!frame_due && !poll_due)
+      break;
+    // whichever came first on the controller's clock
+    if(frame_due && (!poll_due || frames[next_frame].t_us <= next_led_poll_us))
+    {
+      const recorded_frame_t &fr = frames[next_frame++];
+      memcpy(bus.rx_buf, fr.data.data(), fr.data.size());
+      bus.rx_len = fr.data.size();
+      bus.rx_pos = 0;
+      bus.count(1 + fr.data.size());
+      bus.stats.writes++;
+      wire_sim_replay_stats.frames++;
+      if(bus.on_receive)
+        bus.on_receive((int)fr.data.size());
+    } else
+    {
+      next_led_poll_us += LED_POLL_US;
+      bus.tx_len = 0;
+      if(bus.on_request)
+        bus.on_request();
+      bus.count(1 + bus.tx_len);
+      bus.stats.reads++;
+      wire_sim_replay_stats.led_reads++;
+      wire_sim_replay_stats.led_bytes += bus.tx_len;
+    }
+  }
+}
@@ -0,0 +1,259 @@
+// Host benchmark of SD card streaming (stream.cpp), on simulated time.
+//
+// Tracks of stereo tones are laid out one after another in a temporary
+// image file, which blockdev_file serves with SD card read timing. The UI
+// core's side is a loop that spends ui_us on its other work, then calls
+// stream_service(), or idles 100 us if there was nothing to read. The audio
+// core's side renders a block every block time. Both run on one simulated
+// clock: a read's latency passes in wait_us(), which renders the blocks
+// that fall due meanwhile, so a read that comes back too late shows up as
+// an underrun just as it would on the Pico.
+//
+// For each card timing profile it finds the most tracks that play through
+// the whole run without an underrun. The bench is built with room for more
+// tracks than the firmware has (STREAM_MAX_TRACKS), to find what the card
+// allows rather than what the RAM does.
+//
+//   stream_bench [-s seconds] [-u ui_us] [-l cmd_us,block_us,jitter_us,stall_us,stall_every]
+//                [-o mix.wav]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "audio_engine.h"
+#include "stream.h"
+#include "defines.h"
+#include "blockdev_file.h"
+#include "wav_writer.h"
+
+typedef struct
+{
+  const char *name;
+  uint32_t cmd_us, block_us, jitter_us, stall_us, stall_every;
+} profile_t;
+
+static profile_t profiles[] =
+{
+  { "SDIO 4-bit, 25 MHz",                150,  41, 200,     0,   0 },
+  { "SPI, 25 MHz",                       250, 164, 300,     0,   0 },
+  { "SPI, 25 MHz, 25 ms stall every 500 reads", 250, 164, 300, 25000, 500 },
+};
+
+static uint64_t now_us = 0;
+static uint64_t start_us = 0;
+static uint32_t blocks_done = 0;
+static bool audio_on = false;
+static wav_writer_t *wav = NULL;
+
+// renders the audio blocks due by now
+static void run_audio(void)
+{
+  if(!audio_on)
+    return;
+  for(;;)
+  {
+    uint64_t due = start_us + (uint64_t)blocks_done * AUDIO_BLOCK_FRAMES * 1000000 / SAMPLE_RATE_HZ;
+    if(due > now_us)
+      break;
+    int16_t *blk = audio_render_block();
+    if(wav)
+      wav_write(wav, blk, AUDIO_BLOCK_FRAMES);
+    blocks_done++;
+  }
+}
+
+static void wait_us(uint32_t us)
+{
+  now_us += us;
+  run_audio();
+}
+
+// One run with n tracks. Returns the underruns. With 'late', the last track
+// is only opened half way through, and plays once its ring has filled;
+// *late_us is then how long that took.
+static uint32_t trial(blockdev_file_t *bd, const profile_t *p, uint32_t n, uint32_t track_blocks,
+                      uint32_t track_bytes, double seconds, uint32_t ui_us,
+                      bool late = false, uint32_t *late_us = NULL)
+{
+  stream_dev_t dev = { blockdev_file_read, bd };
+  bd->cmd_us = p->cmd_us;
+  bd->block_us = p->block_us;
+  bd->jitter_us = p->jitter_us;
+  bd->stall_us = p->stall_us;
+  bd->stall_every = p->stall_every;
+  bd->wait_us = wait_us;
+  bd->reads = bd->stalls = 0;
+  bd->busy_us = 0;
+  bd->max_us = 0;
+  bd->rng = 0x9E3779B9;
+
+  now_us = 0;
+  audio_on = false;
+  stream_init(&dev);
+  audio_engine_init(SAMPLE_RATE_HZ);
+  audio_set_renderer(stream_render, NULL);
+  uint32_t first = late ? n - 1 : n;
+  for(uint32_t i=0;i<first;i++)
+    stream_open(i * track_blocks, track_bytes, 2, SAMPLE_RATE_HZ);
+  // fill every ring before starting, as a song would
+  for(;;)
+  {
+    bool ready = true;
+    for(uint32_t i=0;i<first;i++)
+      ready = ready && stream_ready(i);
+    if(ready || !stream_service())
+      break;
+  }
+  for(uint32_t i=0;i<first;i++)
+    stream_play(i, 32767 / 4);
+
+  stream_stats.reads = 0;
+  stream_stats.bytes = 0;
+  bd->busy_us = 0;
+  bd->max_us = 0;
+  start_us = now_us;
+  blocks_done = 0;
+  audio_on = true;
+  uint64_t end = now_us + (uint64_t)(seconds * 1e6);
+  uint64_t late_at = now_us + (uint64_t)(seconds * 1e6 / 2);
+  int late_track = -1;
+  bool late_playing = false;
+  while(now_us < end)
+  {
+    if(late && late_track < 0 && now_us >= late_at)
+      late_track = stream_open((n - 1) * track_blocks, track_bytes, 2, SAMPLE_RATE_HZ);
+    if(late_track >= 0 && !late_playing && stream_ready(late_track))
+    {
+      stream_play(late_track, 32767 / 4);
+      late_playing = true;
+      if(late_us)
+        *late_us = now_us - late_at;
+    }
+    if(ui_us)
+      wait_us(ui_us);
+    if(!stream_service())
+      wait_us(100);
+  }
+  audio_on = false;
+  return stream_stats.underruns;
+}
+
+int main(int argc, char **argv)
+{
+  double seconds = 5.0;
+  uint32_t ui_us = 0;
+  const char *wav_path = NULL;
+  profile_t custom = { "custom", 0, 0, 0, 0, 0 };
+  bool use_custom = false;
+
+  for(int i=1;i<argc;i++)
+  {
+    if(!strcmp(argv[i], "-s") && i+1 < argc)
+      seconds = atof(argv[++i]);
+    else if(!strcmp(argv[i], "-u") && i+1 < argc)
+      ui_us = atoi(argv[++i]);
+    else if(!strcmp(argv[i], "-o") && i+1 < argc)
+      wav_path = argv[++i];
+    else if(!strcmp(argv[i], "-l") && i+1 < argc &&
+            sscanf(argv[++i], "%u,%u,%u,%u,%u", &custom.cmd_us, &custom.block_us,
+                   &custom.jitter_us, &custom.stall_us, &custom.stall_every) >= 2)
+      use_custom = true;
+    else
+    {
+      fprintf(stderr, "usage: %s [-s seconds] [-u ui_us] "
+              "[-l cmd_us,block_us,jitter_us,stall_us,stall_every] [-o mix.wav]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  // a tone per track, a little longer than the run
+  uint32_t track_frames = (uint32_t)((seconds + 1) * SAMPLE_RATE_HZ);
+  uint32_t track_bytes = track_frames * 4;
+  // laid out back to back, each starting on a chunk, as stream_open() wants
+  uint32_t track_blocks = (track_bytes + STREAM_CHUNK_BYTES - 1) / STREAM_CHUNK_BYTES * STREAM_CHUNK_BLOCKS;
+  FILE *img = tmpfile();
+  if(!img)
+  {
+    fprintf(stderr, "can't make the track image\n");
+    return 1;
+  }
+  static int16_t buf[STREAM_BLOCK_BYTES / 2];
+  for(uint32_t t=0;t<STREAM_MAX_TRACKS;t++)
+  {
+    double hz = 110.0 * pow(2, t / 12.0);
+    uint32_t f = 0;
+    for(uint32_t b=0;b<track_blocks;b++)
+    {
+      for(uint32_t i=0;i<STREAM_BLOCK_BYTES / 4;i++, f++)
+      {
+        int16_t s = f < track_frames ? (int16_t)lrint(8000 * sin(2 * M_PI * hz * f / SAMPLE_RATE_HZ)) : 0;
+        buf[i * 2] = s;
+        buf[i * 2 + 1] = s;
+      }
+      fwrite(buf, STREAM_BLOCK_BYTES, 1, img);
+    }
+  }
+  blockdev_file_t bd;
+  memset(&bd, 0, sizeof(bd));
+  blockdev_file_attach(&bd, img);
+
+  printf("rings of %d x %d KB per track (%.1f ms at %d Hz stereo), %.1f s runs, %u us of UI work per pass\n",
+         STREAM_RING_CHUNKS, STREAM_CHUNK_BYTES / 1024,
+         1000.0 * STREAM_RING_BYTES / 4 / SAMPLE_RATE_HZ, SAMPLE_RATE_HZ, seconds, ui_us);
+  profile_t *list = use_custom ? &custom : profiles;
+  unsigned n_profiles = use_custom ? 1 : sizeof(profiles) / sizeof(profiles[0]);
+  uint32_t first_max = 0;
+  for(unsigned p=0;p<n_profiles;p++)
+  {
+    const profile_t *pr = &list[p];
+    printf("%s (%u us + %u us/block, jitter %u us", pr->name, pr->cmd_us, pr->block_us, pr->jitter_us);
+    if(pr->stall_every)
+      printf(", %u us stall every %u reads", pr->stall_us, pr->stall_every);
+    printf("):\n");
+    uint32_t best = 0;
+    stream_stats_t best_stats = stream_stats;
+    blockdev_file_t best_bd = bd;
+    for(uint32_t n=1;n<=STREAM_MAX_TRACKS;n++)
+    {
+      if(trial(&bd, pr, n, track_blocks, track_bytes, seconds, ui_us))
+        break;
+      best = n;
+      best_stats = stream_stats;
+      best_bd = bd;
+    }
+    if(!best)
+    {
+      printf("  even one track underruns (%u underruns)\n", stream_stats.underruns);
+      continue;
+    }
+    printf("  %u tracks%s without an underrun: card busy %.0f%%, %u reads, slowest %.1f ms, "
+           "least lead %.1f ms\n",
+           best, best == STREAM_MAX_TRACKS ? " (all there are)" : "",
+           100.0 * best_bd.busy_us / (seconds * 1e6), best_stats.reads,
+           best_bd.max_us / 1000.0, best_stats.min_lead_us / 1000.0);
+    // one of them started while the rest play, as a cue would
+    uint32_t late_us = 0;
+    uint32_t late_underruns = trial(&bd, pr, best, track_blocks, track_bytes, seconds, ui_us, true, &late_us);
+    printf("  the last of them started mid-run: %u underruns, playing after %.1f ms\n",
+           late_underruns, late_us / 1000.0);
+    if(p == 0)
+      first_max = best;
+  }
+
+  if(wav_path && first_max)
+  {
+    wav_writer_t w;
+    if(!wav_open(&w, wav_path, SAMPLE_RATE_HZ, AUDIO_CHANNELS))
+    {
+      fprintf(stderr, "can't write %s\n", wav_path);
+      return 1;
+    }
+    wav = &w;
+    trial(&bd, &list[0], first_max, track_blocks, track_bytes, seconds, ui_us);
+    wav_close(&w);
+    printf("%u tracks of %s -> %s\n", first_max, list[0].name, wav_path);
+  }
+  blockdev_file_close(&bd);
+  return 0;
+}
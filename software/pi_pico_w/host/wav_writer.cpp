@@ -0,0 +1,60 @@
+#include "wav_writer.h"
+
+static void put16(FILE *f, uint16_t v)
+{
+  fputc(v & 0xFF, f);
+  fputc(v >> 8, f);
+}
+
+static void put32(FILE *f, uint32_t v)
+{
+  put16(f, v & 0xFFFF);
+  put16(f, v >> 16);
+}
+
+static void write_header(wav_writer_t *w)
+{
+  uint32_t data_bytes = w->frames * w->channels * 2;
+  fwrite("RIFF", 1, 4, w->f);
+  put32(w->f, 36 + data_bytes);
+  fwrite("WAVEfmt ", 1, 8, w->f);
+  put32(w->f, 16);                          // fmt chunk size
+  put16(w->f, 1);                           // PCM
+  put16(w->f, w->channels);
+  put32(w->f, w->rate_hz);
+  put32(w->f, w->rate_hz * w->channels * 2);   // byte rate
+  put16(w->f, w->channels * 2);             // block align
+  put16(w->f, 16);                          // bits per sample
+  fwrite("data", 1, 4, w->f);
+  put32(w->f, data_bytes);
+}
+
+bool wav_open(wav_writer_t *w, const char *path, uint32_t rate_hz, uint32_t channels)
+{
+  w->f = fopen(path, "wb");
+  w->rate_hz = rate_hz;
+  w->channels = channels;
+  w->frames = 0;
+  if(!w->f)
+    return false;
+  write_header(w);
+  return true;
+}
+
+// samples are host-order interleaved int16, which is little-endian on
+// every machine we build on
+void wav_write(wav_writer_t *w, const int16_t *samples, uint32_t frames)
+{
+  fwrite(samples, sizeof(int16_t) * w->channels, frames, w->f);
+  w->frames += frames;
+}
+
+void wav_close(wav_writer_t *w)
+{
+  if(!w->f)
+    return;
+  fseek(w->f, 0, SEEK_SET);
+  write_header(w);
+  fclose(w->f);
+  w->f = NULL;
+}
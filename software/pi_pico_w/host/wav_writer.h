@@ -0,0 +1,21 @@
+#ifndef __WAV_WRITER_H__
+#define __WAV_WRITER_H__
+
+#include <stdio.h>
+#include <stdint.h>
+
+// Minimal 16-bit PCM WAV file writer for the host builds. The header is
+// written with zero sizes on open and patched on close.
+typedef struct
+{
+  FILE    *f;
+  uint32_t rate_hz;
+  uint32_t channels;
+  uint32_t frames;
+} wav_writer_t;
+
+bool wav_open(wav_writer_t *w, const char *path, uint32_t rate_hz, uint32_t channels);
+void wav_write(wav_writer_t *w, const int16_t *samples, uint32_t frames);
+void wav_close(wav_writer_t *w);
+
+#endif
@@ -0,0 +1,198 @@
+#include <string.h>
+#include "kb_link.h"
+
+spsc_queue<kb_frame_t, KB_QUEUE_LEN> kb_rx_q;
+volatile kb_stats_t kb_stats;
+// all switches open until the first keyframe says otherwise
+uint8_t kb_rows[KB_MATRIX_ROWS] = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+bool kb_in_sync = false;
+int32_t kb_enc_pos[8];
+kb_telemetry_t kb_telemetry;
+
+static kb_event_fn on_event = NULL;
+static uint8_t next_seq = 0;
+
+// LED modes as last asked for, and which of them the controller hasn't got
+static uint8_t led_mode[KB_NUM_LEDS][3];  // mode, level, rate
+static uint64_t led_dirty = 0;
+static uint8_t led_frames[2][KB_LED_FRAME_LEN];
+static volatile uint8_t led_front = 0;    // the frame the controller reads
+static uint8_t led_acked = 0;             // last LED frame the controller took in
+
+void kb_set_event_handler(kb_event_fn fn)
+{
+  on_event = fn;
+}
+
+// Row and bit of the matrix that holds a key's state.
+static void key_position(uint8_t id, uint8_t *row, uint8_t *bit)
+{
+  if(id >= KB_ID_ENC_CLICK(0))
+    *row = KB_ROW_ENC_CLICK;
+  else
+    *row = KB_ROW_BTN_NO(id >> 3);
+  *bit = 1 << (id & 7);
+}
+
+// A keyframe replaces the whole mirror. Any key it shows in a different
+// state than we had is reported, so a lost frame can't leave a note stuck.
+static void apply_keyframe(const uint8_t *rows, uint16_t t_ms)
+{
+  for(uint8_t id=0;id<KB_NUM_KEYS;id++)
+  {
+    uint8_t row, bit;
+    key_position(id, &row, &bit);
+    if(!((kb_rows[row] ^ rows[row]) & bit))
+      continue;
+    if(on_event)
+    {
+      bool up = rows[row] & bit;
+      on_event(up ? KB_EV_RELEASE : KB_EV_PRESS, id, 127, t_ms);
+    }
+  }
+  memcpy(kb_rows, rows, KB_MATRIX_ROWS);
+  kb_in_sync = true;
+  kb_stats.keyframes++;
+}
+
+static uint16_t get16(const uint8_t *p)
+{
+  return p[0] | (p[1] << 8);
+}
+
+static void apply_telemetry(const uint8_t *p)
+{
+  kb_telemetry_t *t = &kb_telemetry;
+  t->scan_min_us = get16(p + KB_TM_SCAN_MIN);
+  t->scan_max_us = get16(p + KB_TM_SCAN_MAX);
+  t->led_min_us = get16(p + KB_TM_LED_MIN);
+  t->led_max_us = get16(p + KB_TM_LED_MAX);
+  t->overruns = get16(p + KB_TM_OVERRUNS);
+  t->twi_dropped = get16(p + KB_TM_TWI_DROPPED);
+  t->twi_errors = get16(p + KB_TM_TWI_ERRORS);
+  t->twi_recovered = get16(p + KB_TM_TWI_RECOVERED);
+  memcpy(t->scan_hist, p + KB_TM_SCAN_HIST, 8);
+  memcpy(t->led_hist, p + KB_TM_LED_HIST, 8);
+  t->reports++;
+}
+
+void kb_apply_frame(const kb_frame_t *f)
+{
+  if(f->len < KB_HEADER_LEN)
+    return;
+  uint8_t hdr = f->data[0];
+  uint16_t t_ms = f->data[1] | (f->data[2] << 8);
+  led_acked = f->data[3];
+  const uint8_t *p = f->data + KB_HEADER_LEN;
+  uint8_t n = f->len - KB_HEADER_LEN;
+
+  if((hdr & KB_SEQ_MASK) != next_seq)
+  {
+    kb_stats.seq_gaps++;
+    kb_in_sync = false;
+  }
+  next_seq = (hdr + 1) & KB_SEQ_MASK;
+
+  switch(hdr & KB_FRAME_KIND_MASK)
+  {
+  case KB_FRAME_KEYFRAME:
+    if(n >= KB_MATRIX_ROWS)
+      apply_keyframe(p, t_ms);
+    break;
+
+  case KB_FRAME_TELEMETRY:
+    if(n >= KB_TM_LEN)
+      apply_telemetry(p);
+    break;
+
+  case KB_FRAME_EVENTS:
+    for(;n>=2;n-=2, p+=2)
+    {
+      uint8_t type = p[0] & KB_EV_TYPE_MASK;
+      uint8_t id = p[0] & KB_EV_ID_MASK;
+      uint8_t row, bit;
+      switch(type)
+      {
+      case KB_EV_PRESS:
+      case KB_EV_RELEASE:
+        if(id >= KB_NUM_KEYS)
+          break;
+        key_position(id, &row, &bit);
+        if(type == KB_EV_PRESS)
+          kb_rows[row] &= ~bit;
+        else
+          kb_rows[row] |= bit;
+        if(on_event)
+          on_event(type, id, p[1], t_ms);
+        break;
+      case KB_EV_ENCODER:
+        if(id >= 8)
+          break;
+        kb_enc_pos[id] += (int8_t)p[1];
+        if(on_event)
+          on_event(type, id, p[1], t_ms);
+        break;
+      case KB_EV_RAW:
+        if(id < KB_MATRIX_ROWS)
+          kb_rows[id] = p[1];
+        break;
+      }
+    }
+    break;
+  }
+}
+
+void kb_led_mode(uint8_t led, uint8_t mode, uint8_t level, uint8_t rate)
+{
+  if(led >= KB_NUM_LEDS)
+    return;
+  uint8_t *m = led_mode[led];
+  level &= 15;
+  rate &= 15;
+  if(m[0] == mode && m[1] == level && m[2] == rate)
+    return;
+  m[0] = mode;
+  m[1] = level;
+  m[2] = rate;
+  led_dirty |= 1ull << led;
+}
+
+void kb_led_set(uint8_t led, uint8_t level)
+{
+  kb_led_mode(led, KB_LED_STEADY, level, 0);
+}
+
+// Once the controller has acknowledged the frame it can see, builds a new
+// one from the changed LEDs in the back buffer, then flips. The onRequest
+// callback interrupts the main loop, never the other way round, so it
+// always sees a whole frame. An LED changed more than once before it goes
+// out is only sent in its latest mode.
+void kb_led_commit(void)
+{
+  uint8_t front = led_front;
+  if(!led_dirty || led_acked != led_frames[front][0])
+    return;
+  uint8_t *f = led_frames[front ^ 1];
+  uint8_t *cmd = f + 2;
+  uint8_t n = 0;
+  for(uint8_t led=0;led<KB_NUM_LEDS && n<KB_LED_MAX_CMDS;led++)
+  {
+    if(!(led_dirty & (1ull << led)))
+      continue;
+    led_dirty &= ~(1ull << led);
+    cmd[0] = led;
+    memcpy(cmd + 1, led_mode[led], 3);
+    cmd += KB_LED_CMD_LEN;
+    n++;
+  }
+  f[0] = led_frames[front][0] + 1;
+  f[1] = n;
+  led_front = front ^ 1;
+}
+
+const uint8_t *kb_led_frame(void)
+{
+  return led_frames[led_front];
+}
@@ -0,0 +1,79 @@
+#ifndef __KB_LINK_H__
+#define __KB_LINK_H__
+
+#include <stdint.h>
+#include "spsc_queue.h"
+#include "defines.h"
+#include "kb_proto.h"
+
+// Frames written to us by the keyboard controller arrive in the
+// Wire.onReceive callback, which copies each one into this ring along with
+// its arrival time. The main loop drains the ring at its own pace. If it
+// falls more than KB_QUEUE_LEN frames behind, new frames are dropped and
+// counted, and frames already queued are never overwritten mid-read.
+//
+// kb_apply_frame() decodes a frame (see kb_proto.h) into kb_rows, a mirror
+// of the switch matrix, and passes each key event to the event handler.
+//
+// LED modes go the other way. kb_led_mode() and kb_led_set() record what
+// each LED should do, and the controller animates blinks, pulses and chases
+// itself, so only changes cross the bus. kb_led_commit() packs the changed
+// LEDs into the next LED frame once the controller has acknowledged the
+// last one. There are two frames, and the commit switches the
+// Wire.onRequest callback over to the new one, so the callback only has to
+// write out kb_led_frame().
+
+#define KB_FRAME_MAX  40    // bytes per frame; longer writes are truncated
+#define KB_QUEUE_LEN  32    // 32 ms of frames at KB_FULLSCAN_HZ
+
+typedef struct
+{
+  uint32_t t_us;            // micros() when the frame arrived
+  uint8_t  len;
+  uint8_t  data[KB_FRAME_MAX];
+} kb_frame_t;
+
+typedef struct
+{
+  uint32_t received;        // frames queued
+  uint32_t dropped;         // frames lost because the ring was full
+  uint32_t truncated;       // frames longer than KB_FRAME_MAX
+  uint32_t high_water;      // most frames ever waiting at once
+  uint32_t seq_gaps;        // frames lost somewhere between scan and us
+  uint32_t keyframes;
+} kb_stats_t;
+
+// The controller's latest telemetry report (see kb_proto.h), in microseconds
+typedef struct
+{
+  uint32_t reports;
+  uint16_t scan_min_us, scan_max_us;
+  uint16_t led_min_us, led_max_us;
+  uint16_t overruns;
+  uint16_t twi_dropped, twi_errors, twi_recovered;
+  uint8_t  scan_hist[8];    // KB_TM_SCAN_BIN_US bins
+  uint8_t  led_hist[8];     // KB_TM_LED_BIN_US bins
+} kb_telemetry_t;
+
+// type is KB_EV_PRESS, KB_EV_RELEASE or KB_EV_ENCODER (value is then a
+// signed detent count), and t_ms is the controller's scan time
+typedef void (*kb_event_fn)(uint8_t type, uint8_t id, uint8_t value, uint16_t t_ms);
+
+extern spsc_queue<kb_frame_t, KB_QUEUE_LEN> kb_rx_q;
+extern volatile kb_stats_t kb_stats;
+extern uint8_t kb_rows[KB_MATRIX_ROWS];   // zero bits are closed switches
+extern bool kb_in_sync;                   // false from a lost frame until the next keyframe
+extern int32_t kb_enc_pos[8];             // detents turned since power-up
+extern kb_telemetry_t kb_telemetry;
+
+void kb_set_event_handler(kb_event_fn fn);
+void kb_apply_frame(const kb_frame_t *f);
+
+// mode is KB_LED_*, level 0..15, and the mode's time step is 2^rate ms.
+// LEDs are numbered like the buttons.
+void kb_led_mode(uint8_t led, uint8_t mode, uint8_t level, uint8_t rate);
+void kb_led_set(uint8_t led, uint8_t level);    // steady
+void kb_led_commit(void);                       // sends changes, when the controller is ready
+const uint8_t *kb_led_frame(void);              // KB_LED_FRAME_LEN bytes for the controller
+
+#endif
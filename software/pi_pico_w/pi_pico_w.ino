@@ -4,16 +4,24 @@
 #include <I2S.h>
 #include "hardware/pwm.h"
 #include "defines.h"
-#include "mock_screen.h"
-
-static char buff[100];
-static char codec_i2c_buff[100];
+#include "asset_mock_screen.h"
+#include "audio_engine.h"
+#include "audio_link.h"
+#include "kb_link.h"
+#include "compositor.h"
+#include "text_layer.h"
+#include "codec.h"
+#include "sampler.h"
+
+// defined further down; declared here so the sketch is also plain C++ for
+// the host simulator
+void recv(int len);
+void req(void);
+void key_event(uint8_t type, uint8_t id, uint8_t value, uint16_t t_ms);
+uint8_t key_led_level(uint8_t velocity);
 
 TFT_eSPI tft = TFT_eSPI();       // Invoke custom library
 
-volatile uint8_t last_len = 0;
-volatile uint8_t codec_i2c_last_len = 0;
-
 // Create the I2S port using a PIO state machine
 I2S i2s(OUTPUT);
 
@@ -32,82 +40,153 @@ void I2S_EnableMCLK(unsigned long rate_hz)
 }
 */
 
-void I2C_WriteWAU8822(uint8_t u8addr, uint16_t u16data) 
+// Codec registers after reset, sent in one session at bring-up. The rate
+// registers (6, 7 and 36..39) are left to WAU8822_ConfigSampleRate().
+constexpr codec_reg_t codec_boot_regs[] =
 {
-  Wire1.beginTransmission(NAU8822_I2C_ADDRESS);
-  Wire1.write(u8addr<<1);
-  Wire1.write((uint8_t)((u8addr << 1) | (u16data >> 8)));
-  Wire1.write((uint8_t)(u16data & 0x00FF));
-  Wire1.endTransmission();
-}
+  { 1,  0x02F },
+  { 2,  0x1B3 },   // Enable L/R Headphone, ADC Mix/Boost, ADC
+  { 3,  0x07F },   // Enable L/R main mixer, DAC
+  { 4,  0x010 },   // 16-bit word length, I2S format, Stereo (default is 24-bit)
+  { 5,  0x000 },   // Companding control and loop back mode (all disable)
+  { 10, 0x008 },   // DAC soft mute is disabled, DAC oversampling rate is 128x
+  { 14, 0x108 },   // ADC HP filter is disabled, ADC oversampling rate is 128x
+  { 15, 0x1EF },   // ADC left digital volume control
+  { 16, 0x1EF },   // ADC right digital volume control
+  { 44, 0x000 },   // LLIN/RLIN is not connected to PGA
+  { 47, 0x050 },   // LLIN connected, and its Gain value
+  { 48, 0x050 },   // RLIN connected, and its Gain value
+  { 50, 0x001 },   // Left DAC connected to LMIX
+  { 51, 0x001 },   // Right DAC connected to RMIX
+};
+#define CODEC_BOOT_REGS (sizeof(codec_boot_regs) / sizeof(codec_boot_regs[0]))
+static_assert(codec_table_ok(codec_boot_regs, CODEC_BOOT_REGS), "bad codec boot register table");
+
+// Sample rates. Each family has its own PLL setting: 24.576 MHz out for
+// the 48 kHz rates, 22.5792 MHz for the 44.1 kHz ones. Register 6 divides
+// that down to 256 x fs (MCLKSEL), and register 7 picks the nearest filter
+// coefficient set (SMPLR).
+enum { CODEC_PLL_48K, CODEC_PLL_44K1 };
+
+constexpr codec_reg_t codec_pll_regs[2][4] =
+{
+  { { 36, 0x008 }, { 37, 0x00C }, { 38, 0x093 }, { 39, 0x0E9 } },  // 12.288Mhz
+  { { 36, 0x007 }, { 37, 0x021 }, { 38, 0x131 }, { 39, 0x026 } },  // 11.2896Mhz
+};
+static_assert(codec_table_ok(codec_pll_regs[0], 4) && codec_table_ok(codec_pll_regs[1], 4),
+              "bad codec PLL register table");
+constexpr uint32_t codec_pll_hz[2] = { 24576000, 22579200 };
+// MCLKSEL divides by 1, 1.5, 2, 3, 4, 6, 8 or 12; here in halves
+constexpr uint8_t codec_mclk_half_div[8] = { 2, 3, 4, 6, 8, 12, 16, 24 };
+// SMPLR filter sets
+constexpr uint32_t codec_smplr_hz[6] = { 48000, 32000, 24000, 16000, 12000, 8000 };
+
+typedef struct
+{
+  uint32_t hz;
+  uint8_t  pll;       // CODEC_PLL_*
+  uint8_t  mclksel;   // register 6 bits 7..5
+  uint8_t  smplr;     // register 7 bits 3..1
+} codec_rate_t;
 
-uint16_t I2C_ReadWAU8822(uint8_t u8addr) 
-{
-  uint16_t res = 0;
-  Wire1.beginTransmission(NAU8822_I2C_ADDRESS);
-  Wire1.write(u8addr<<1);
-  Wire1.requestFrom(NAU8822_I2C_ADDRESS,2,true);
-  res=Wire1.read();
-  res<<=8;
-  res|=Wire1.read();
-  Wire1.endTransmission();
-  return res;
+constexpr codec_rate_t codec_rates[] =
+{
+  {  8000, CODEC_PLL_48K,  7, 5 },
+  { 11025, CODEC_PLL_44K1, 6, 4 },
+  { 12000, CODEC_PLL_48K,  6, 4 },
+  { 16000, CODEC_PLL_48K,  5, 3 },
+  { 22050, CODEC_PLL_44K1, 4, 2 },
+  { 24000, CODEC_PLL_48K,  4, 2 },
+  { 32000, CODEC_PLL_48K,  3, 1 },
+  { 44100, CODEC_PLL_44K1, 2, 0 },
+  { 48000, CODEC_PLL_48K,  2, 0 },
+};
+#define CODEC_NUM_RATES (sizeof(codec_rates) / sizeof(codec_rates[0]))
+
+// Every rate must divide exactly out of its PLL, and use a filter set
+// within 10% of it.
+constexpr bool codec_rates_ok(void)
+{
+  for(unsigned i=0;i<CODEC_NUM_RATES;i++)
+  {
+    const codec_rate_t &r = codec_rates[i];
+    if(r.pll > CODEC_PLL_44K1 || r.mclksel > 7 || r.smplr > 5)
+      return false;
+    if((uint64_t)codec_pll_hz[r.pll] * 2 != (uint64_t)r.hz * 256 * codec_mclk_half_div[r.mclksel])
+      return false;
+    uint32_t f = codec_smplr_hz[r.smplr];
+    if(r.hz * 10 < f * 9 || r.hz * 10 > f * 11)
+      return false;
+  }
+  return true;
 }
+static_assert(codec_rates_ok(), "bad codec sample rate table");
 
-void WAU8822_ConfigSampleRate(uint32_t u32SampleRate)
+// index into codec_rates, or -1
+constexpr int codec_rate_index(uint32_t hz)
 {
-    if((u32SampleRate % 8) == 0)
-    {
-        I2C_WriteWAU8822(36, 0x008);    //12.288Mhz
-        I2C_WriteWAU8822(37, 0x00C);
-        I2C_WriteWAU8822(38, 0x093);
-        I2C_WriteWAU8822(39, 0x0E9);
-    }
-    else
-    {
-        I2C_WriteWAU8822(36, 0x007);    //11.2896Mhz
-        I2C_WriteWAU8822(37, 0x021);
-        I2C_WriteWAU8822(38, 0x131);
-        I2C_WriteWAU8822(39, 0x026);
-    }
+  for(unsigned i=0;i<CODEC_NUM_RATES;i++)
+    if(codec_rates[i].hz == hz)
+      return i;
+  return -1;
+}
+static_assert(codec_rate_index(SAMPLE_RATE_HZ) >= 0, "SAMPLE_RATE_HZ isn't in codec_rates");
 
-    switch (u32SampleRate)
-    {
-    case 16000:
-        I2C_WriteWAU8822(6, 0x1AD);   /* Divide by 6, 16K */
-        I2C_WriteWAU8822(7, 0x006);   /* 16K for internal filter coefficients */
-        break;
-
-    case 32000:
-        I2C_WriteWAU8822(6, 0x16D);    /* Divide by 3, 32K */
-        I2C_WriteWAU8822(7, 0x002);    /* 32K for internal filter coefficients */
-        break;
-
-    case 44100:
-    case 48000:
-        I2C_WriteWAU8822(6, 0x14D);    /* Divide by 1, 48K */
-        I2C_WriteWAU8822(7, 0x000);    /* 48K for internal filter coefficients */
-        break;
-    }
+const codec_rate_t *codec_rate_find(uint32_t hz)
+{
+  int i = codec_rate_index(hz);
+  return i < 0 ? NULL : &codec_rates[i];
 }
 
-void Delay(int count)
+// Stages the PLL and clock divider registers for a sample rate; the caller
+// commits them. Returns false for a rate the table doesn't have.
+bool WAU8822_ConfigSampleRate(uint32_t u32SampleRate)
 {
-    volatile uint32_t i;
-    for (i = 0; i < count ; i++);
+    const codec_rate_t *r = codec_rate_find(u32SampleRate);
+    if(!r)
+        return false;
+    codec_load(codec_pll_regs[r->pll], 4);
+    codec_set(6, 0x10D | (r->mclksel << 5));   /* PLL, MCLK divider, BCLK = MCLK/8, master */
+    codec_set(7, r->smplr << 1);               /* internal filter coefficients */
+    return true;
 }
 
 void setup()   
 {
+  // audio codec i2c. The codec is reset first, and settles while the
+  // display controller comes up, so its bring-up costs setup() only the
+  // bus time of the table. The codec is ready once tft.init() returns,
+  // which is no later than the keys can reach it.
+  pinMode(pSDA,INPUT);
+  pinMode(pSCL,INPUT);
+  Wire1.setSDA(pSDA);
+  Wire1.setSCL(pSCL);
+  Wire1.setClock(400000);
+  Wire1.begin();
+  codec_init(&Wire1, NAU8822_I2C_ADDRESS);
+  codec_reset();
+
   tft.init();
+
+  // audio codec init, in one bus session. The reset has long since settled
+  // by now, so this doesn't wait.
+  codec_wait_reset();
+  codec_load(codec_boot_regs, CODEC_BOOT_REGS);
+  // Set MCLK and enable MCLK 
+  //I2S_EnableMCLK(12000000);
+  WAU8822_ConfigSampleRate(SAMPLE_RATE_HZ);
+  codec_commit();
+
+  pinMode(LED_BUILTIN, OUTPUT);
+  digitalWrite(LED_BUILTIN, 1);
+
   tft.setRotation(1);
   tft.fillScreen(TFT_BLACK);
   tft.setTextSize(1);
   tft.setTextColor(TFT_WHITE);
   tft.setCursor(0, 0);
-
-  pinMode(LED_BUILTIN, OUTPUT);
-  digitalWrite(LED_BUILTIN, 1);
+  comp_init(&tft, NULL);
+  text_init(&tft, 0, 25);   // text row 0 sits in the black band
 
   Serial.begin(115200);
   Serial.println("I2S simple tone");
@@ -117,57 +196,23 @@ void setup()
   pinMode(kSCL,INPUT);
   Wire.onReceive(recv);
   Wire.onRequest(req);
+  kb_set_event_handler(key_event);
   Wire.setSDA(kSDA);
   Wire.setSCL(kSCL);
   Wire.begin(0x30);
 
-  // audio codec i2c
-  pinMode(pSDA,INPUT);
-  pinMode(pSCL,INPUT);
-  Wire1.setSDA(pSDA);
-  Wire1.setSCL(pSCL);
-  Wire1.setClock(100000);
-  Wire1.begin();
+  Serial.printf("codec ready %lu us after boot, %lu us after reset\n",
+                (unsigned long)codec_stats.ready_us,
+                (unsigned long)(codec_stats.ready_us - codec_stats.reset_us));
 
-  // audio codec init 
-  I2C_WriteWAU8822(0,  0x000);   // Reset all registers 
-  Delay(0x200);
-  I2C_WriteWAU8822(1,  0x02F);
-  I2C_WriteWAU8822(2,  0x1B3);   // Enable L/R Headphone, ADC Mix/Boost, ADC 
-  I2C_WriteWAU8822(3,  0x07F);   // Enable L/R main mixer, DAC 
-  // offset: 0x4 => default, 24bit, I2S format, Stereo
-  I2C_WriteWAU8822(4,  0x010);   // 16-bit word length, I2S format, Stereo 
-
-  I2C_WriteWAU8822(5,  0x000);   // Companding control and loop back mode (all disable) 
-  I2C_WriteWAU8822(6,  0x1AD);   // Divide by 6, 16K 
-  I2C_WriteWAU8822(7,  0x006);   // 16K for internal filter coefficients 
-  I2C_WriteWAU8822(10, 0x008);   // DAC soft mute is disabled, DAC oversampling rate is 128x 
-  I2C_WriteWAU8822(14, 0x108);   // ADC HP filter is disabled, ADC oversampling rate is 128x 
-  I2C_WriteWAU8822(15, 0x1EF);   // ADC left digital volume control 
-  I2C_WriteWAU8822(16, 0x1EF);   // ADC right digital volume control 
-
-  I2C_WriteWAU8822(44, 0x000);   // LLIN/RLIN is not connected to PGA 
-  I2C_WriteWAU8822(47, 0x050);   // LLIN connected, and its Gain value 
-  I2C_WriteWAU8822(48, 0x050);   // RLIN connected, and its Gain value 
-  I2C_WriteWAU8822(50, 0x001);   // Left DAC connected to LMIX 
-  I2C_WriteWAU8822(51, 0x001);   // Right DAC connected to RMIX 
-  
-  // Set MCLK and enable MCLK 
-  //I2S_EnableMCLK(12000000);
-  WAU8822_ConfigSampleRate(SAMPLE_RATE_HZ);
-  
   tft.setTextSize(2);
   tft.setCursor(0, 5);
 
-  // start I2S at the sample rate with 16-bits per sample
-  i2s.setMCLK(pMCLK);
-  i2s.setMCLKmult(256);
-  i2s.setBCLK(pBCLK);
-  i2s.setDATA(pDOUT);
-  i2s.setBitsPerSample(16);
-  i2s.setBuffers(2, 256, 0);
-
-  if (!i2s.begin(SAMPLE_RATE_HZ)) 
+  // I2S is started by setup1() on core 1, which owns the audio from here
+  // on. Wait to hear whether it came up.
+  audio_evt_t e;
+  while(!audio_evt_q.pop(e));
+  if (e.evt == AUDIO_EVT_FAILED) 
   {
     Serial.println("Failed to initialize I2S!");
     tft.setTextColor(TFT_VFD_ORANGE);
@@ -179,92 +224,450 @@ void setup()
 
 }
 
-// Called when the I2C slave gets written to
+// Called when the I2C slave gets written to. Queues the frame for the main
+// loop; if the queue is full the frame is discarded and counted.
 void recv(int len) 
 {
-    for (int i=0; i<len; i++) buff[i] = Wire.read();
-    last_len = len;
+    kb_frame_t *f = kb_rx_q.write_slot();
+    if (!f)
+    {
+      while (Wire.available()) Wire.read();
+      kb_stats.dropped++;
+      return;
+    }
+    if (len > KB_FRAME_MAX)
+    {
+      kb_stats.truncated++;
+      len = KB_FRAME_MAX;
+    }
+    f->t_us = micros();
+    for (int i=0; i<len; i++) f->data[i] = Wire.read();
+    while (Wire.available()) Wire.read();
+    f->len = len;
+    kb_rx_q.commit();
+    kb_stats.received++;
+    uint32_t n = kb_rx_q.size();
+    if (n > kb_stats.high_water) kb_stats.high_water = n;
+}
+
+// LED level for a press: velocity 1..127 onto levels 1..15, so the softest
+// press still lights and the hardest (and every press a keyframe brings
+// back, at 127) stays within the four bits an LED level has.
+uint8_t key_led_level(uint8_t velocity)
+{
+  if (velocity > 127) velocity = 127;
+  return 1 + velocity * 14 / 127;
+}
+
+// Lights each button while it is held, brighter the harder it was hit.
+void key_leds(uint8_t type, uint8_t id, uint8_t value)
+{
+  if (type == KB_EV_PRESS)
+    kb_led_set(id, key_led_level(value));
+  else if (type == KB_EV_RELEASE)
+    kb_led_set(id, 0);
+}
+
+// Plays the buttons as a chromatic keyboard, from C3 on the first one,
+// panned left to right across each row.
+#define KEY_NOTE_BASE 48
+
+void key_notes(uint8_t type, uint8_t id, uint8_t value)
+{
+  audio_cmd_t c = { 0, (uint8_t)(KEY_NOTE_BASE + id), value, (uint32_t)(id % 8) * 127 / 7 };
+  if (type == KB_EV_PRESS)
+    c.cmd = AUDIO_CMD_NOTE_ON;
+  else if (type == KB_EV_RELEASE)
+    c.cmd = AUDIO_CMD_NOTE_OFF;
+  else
+    return;
+  audio_cmd_q.push(c);
+}
+
+void key_event(uint8_t type, uint8_t id, uint8_t value, uint16_t t_ms)
+{
+  (void)t_ms;
+  if (id >= KB_NUM_LEDS)
+    return;
+  key_leds(type, id, value);
+  key_notes(type, id, value);
+}
+
+// Applies every frame the receive callback has queued to the key matrix
+// mirror, kb_rows.
+void kb_drain(void)
+{
+  const kb_frame_t *f;
+  while ((f = kb_rx_q.read_slot()))
+  {
+    kb_apply_frame(f);
+    kb_rx_q.release();
+  }
+}
+
+// Once a second, report any keyboard link losses on the serial port.
+void kb_report_stats(void)
+{
+  static uint32_t last_ms = 0;
+  static uint32_t last_dropped = 0;
+  static uint32_t last_gaps = 0;
+  uint32_t now = millis();
+  if (now - last_ms < 1000)
+    return;
+  last_ms = now;
+  uint32_t dropped = kb_stats.dropped;
+  if (dropped != last_dropped || kb_stats.seq_gaps != last_gaps)
+  {
+    Serial.printf("kb: %lu frames, %lu dropped, %lu truncated, max queued %lu/%d, %lu seq gaps\n",
+                  (unsigned long)kb_stats.received, (unsigned long)dropped,
+                  (unsigned long)kb_stats.truncated,
+                  (unsigned long)kb_stats.high_water, KB_QUEUE_LEN,
+                  (unsigned long)kb_stats.seq_gaps);
+    last_dropped = dropped;
+    last_gaps = kb_stats.seq_gaps;
+  }
+  // and any trouble the controller has had keeping up
+  static uint16_t last_overruns = 0;
+  static uint16_t last_twi_errors = 0;
+  const kb_telemetry_t *t = &kb_telemetry;
+  if (t->overruns != last_overruns || t->twi_errors != last_twi_errors)
+  {
+    Serial.printf("kb ctl: scan %u-%u us, led %u-%u us, %u overruns, twi %u dropped %u errors %u recovered\n",
+                  t->scan_min_us, t->scan_max_us, t->led_min_us, t->led_max_us, t->overruns,
+                  t->twi_dropped, t->twi_errors, t->twi_recovered);
+    last_overruns = t->overruns;
+    last_twi_errors = t->twi_errors;
+  }
 }
 
 
-// Called when the I2C slave is read from
+// Called when the I2C slave is read from: the keyboard controller wants
+// its LED frame, which kb_led_commit() keeps ready.
 void req() 
 {
-    static int ctr = 765;
-    char buff[7];
-    // Return a simple incrementing hex value
-    sprintf(buff, "%06X", (ctr++) % 65535);
-    Wire.write(buff, 6);
+    Wire.write(kb_led_frame(), KB_LED_FRAME_LEN);
+}
+
+// Compositor background: rows of the mockup screen, decoded from its
+// compressed asset straight into the compositor's line buffer.
+void mockup_source(int16_t x, int16_t y, int16_t w, uint16_t *line)
+{
+  asset_decode_row(&asset_mock_screen, x, y, w, line);
 }
 
 void draw_mockup(void)
 {
-  uint16_t *p = (uint16_t *)(gimp_image.pixel_data);
-  for(int y=0;y<320;y++)
-  for(int x=0;x<480;x++)
-  {
-    tft.drawFastHLine(x, y, 1, *p);
-    p++;
-  }  
+  comp_set_background(mockup_source);
+  comp_flush();
 }
 
+// One pass of the switch test. The mockup is drawn on the first call.
+// Hex text is only regenerated when the key bytes change, and the text
+// layer then redraws just the digits that differ.
 void switch_test(void)
 {
-  draw_mockup();
+  static bool drawn = false;
+  static uint8_t shown_keys[15];
+  if(!drawn)
+  {
+    draw_mockup();
+    for(int y=20;y<42;y++)
+      tft.drawFastHLine(0, y, 480, 0);
+    memset(shown_keys, 0, sizeof(shown_keys));
+    for(int i=0;i<15;i++)
+      text_hex8(i*2, 0, 0, TFT_VFD_BLUWHT, TFT_BLACK);
+    drawn = true;
+  }
 
-  for(int y=20;y<42;y++)
-    tft.drawFastHLine(0, y, 480, 0);
-  
-  tft.setTextSize(2);
-  char s[6];
-  char lineout[40]="";
-  char oldlineout[40]="";
-  while(1)
+  if(memcmp(shown_keys, kb_rows, 15))
   {
-    lineout[0]=0;
     for(int i=0;i<15;i++)
     {
-      sprintf(s,"%02X",buff[i]);
-      strcat(lineout,s);
+      if(shown_keys[i] != kb_rows[i])
+        text_hex8(i*2, 0, kb_rows[i], TFT_VFD_BLUWHT, TFT_BLACK);
     }
-    uint16_t rval = I2C_ReadWAU8822(36);
-    sprintf(s," %04X",buff[rval]);
-    strcat(lineout,s);
-
-
-    if(strcmp(lineout,oldlineout))
-    {
-      tft.setCursor(0, 25);
-      tft.setTextColor(TFT_BLACK);
-      tft.print(oldlineout);
-
-      tft.setCursor(0, 25);
-      tft.setTextColor(TFT_VFD_BLUWHT);//TFT_VFD_ORANGE);
-      tft.print(lineout);
-      strcpy(oldlineout,lineout);
+    memcpy(shown_keys, kb_rows, 15);
+  }
+  // from the codec's register shadow, so it costs no bus time
+  uint16_t rval;
+  if(codec_read(36, &rval))
+  {
+    text_put(30, 0, ' ', TFT_VFD_BLUWHT, TFT_BLACK);
+    text_hex16(31, 0, rval, TFT_VFD_BLUWHT, TFT_BLACK);
+  }
 
-    }
-  }  
+  text_flush();
 }
 
 void codec_test(void)
 {
+  static bool started = false;
+  if(started)
+    return;
   tft.setTextSize(2);
   tft.setCursor(0, 25);
   tft.setTextColor(TFT_VFD_BLUWHT);//TFT_VFD_ORANGE);
   tft.print("I hope she's making some noise!!!");
-  while(1)
+  audio_cmd_t c = { AUDIO_CMD_RENDERER, AUDIO_SRC_NOISE, 0, 0 };
+  started = audio_cmd_q.push(c);
+}
+
+// Latest report from the audio core, for display.
+struct
+{
+  uint32_t blocks;
+  uint32_t underruns;
+  uint16_t worst_render_us;
+  uint32_t rate_hz;
+  uint32_t switching_to;    // rate being switched to, or 0
+  bool     resume_due;      // AUDIO_CMD_RESUME still to send
+  uint32_t switch_start_us;
+  uint32_t switch_us;       // how long the last switch was silent for
+} audio_status = { 0, 0, 0, SAMPLE_RATE_HZ, 0, false, 0, 0 };
+
+// Starts a switch to another sample rate, between songs. The audio core
+// mutes and drains, the codec is reprogrammed here in audio_poll_events(),
+// then the audio fades back in. Returns false if the rate isn't supported
+// or a switch is still under way.
+bool audio_change_rate(uint32_t hz)
+{
+  if(!codec_rate_find(hz) || audio_status.switching_to)
+    return false;
+  if(hz == audio_status.rate_hz)
+    return true;
+  audio_cmd_t c = { AUDIO_CMD_RATE, 0, 0, hz };
+  if(!audio_cmd_q.push(c))
+    return false;
+  audio_status.switching_to = hz;
+  audio_status.switch_start_us = micros();
+  return true;
+}
+
+void audio_poll_events(void)
+{
+  audio_evt_t e;
+  while(audio_evt_q.pop(e))
+  {
+    switch(e.evt)
+    {
+    case AUDIO_EVT_STATS:
+      audio_status.blocks = e.c;
+      audio_status.underruns += e.a;
+      audio_status.worst_render_us = e.b;
+      break;
+    case AUDIO_EVT_PAUSED:
+      WAU8822_ConfigSampleRate(e.c);
+      codec_commit();
+      audio_status.resume_due = true;
+      break;
+    case AUDIO_EVT_BENCH:
+      {
+        static const char *paths[] = { "linear", "cubic", "interp" };
+        uint32_t budget_us = 1000000ul * AUDIO_BLOCK_FRAMES / audio_status.rate_hz;
+        Serial.printf("sampler %s: %u voices in %lu us of a %lu us block, about %lu voices per core\n",
+                      paths[e.a % 3], e.b, (unsigned long)e.c, (unsigned long)budget_us,
+                      (unsigned long)(e.c ? budget_us * e.b / e.c : 0));
+      }
+      break;
+    case AUDIO_EVT_RATE:
+      audio_status.rate_hz = e.c;
+      audio_status.switching_to = 0;
+      audio_status.switch_us = micros() - audio_status.switch_start_us;
+      Serial.printf("audio: %lu Hz, switched in %lu us\n",
+                    (unsigned long)e.c, (unsigned long)audio_status.switch_us);
+      break;
+    }
+  }
+  if(audio_status.resume_due)
   {
-      i2s.write16(rand()%65536,rand()%65536);
-  };
+    audio_cmd_t c = { AUDIO_CMD_RESUME, 0, 0, 0 };
+    if(audio_cmd_q.push(c))
+      audio_status.resume_due = false;
+  }
 }
 
+// Core 0: display, keyboard I2C slave and codec control. Nothing in here
+// can hold up audio, which only hears from us through audio_cmd_q.
 void loop() 
 {
+  audio_poll_events();
+  kb_drain();
+  kb_led_commit();
+  kb_report_stats();
   switch_test();
   //codec_test();
 }
 
+// ----------------------------------------------------------------------------
+// Core 1: audio rendering. Renders a block, then blocks in i2s.write() until
+// there is a free I2S buffer for it, so the loop runs at the sample rate.
+// ----------------------------------------------------------------------------
+
+// Pushes one rendered block into the I2S buffers, waiting for room as needed.
+void i2s_write_block(const int16_t *blk)
+{
+  const uint8_t *p = (const uint8_t *)blk;
+  size_t left = AUDIO_BLOCK_BYTES;
+  while(left)
+  {
+    size_t n = i2s.write(p, left);
+    p += n;
+    left -= n;
+  }
+}
+
+#if AUDIO_BENCH_AT_BOOT
+// Render time per block of each sampler path with every voice playing,
+// measured before I2S starts and reported once it has.
+static audio_evt_t bench_evts[3];
+
+void audio_boot_bench(void)
+{
+  for(uint8_t mode=SAMPLER_LINEAR;mode<=SAMPLER_INTERP;mode++)
+  {
+    sampler_init(AUDIO_VOICES, mode);
+    for(uint8_t v=0;v<AUDIO_VOICES;v++)
+      sampler_note_on(sampler_test_sample(), 36 + v * 3 / 2, 100, v * 127 / (AUDIO_VOICES - 1));
+    audio_render_block();
+    uint32_t t0 = micros();
+    for(int b=0;b<16;b++)
+      audio_render_block();
+    audio_evt_t e = { AUDIO_EVT_BENCH, mode, AUDIO_VOICES, (micros() - t0) / 16 };
+    bench_evts[mode] = e;
+  }
+}
+#endif
+
+void setup1()
+{
+  audio_engine_init(SAMPLE_RATE_HZ);
+  audio_set_renderer(sampler_render, NULL);
+#if AUDIO_BENCH_AT_BOOT
+  audio_boot_bench();
+#endif
+  sampler_init(AUDIO_VOICES, SAMPLER_INTERP);
+  sampler_test_sample();
+
+  // start I2S at the sample rate with 16-bits per sample
+  i2s.setMCLK(pMCLK);
+  i2s.setMCLKmult(256);
+  i2s.setBCLK(pBCLK);
+  i2s.setDATA(pDOUT);
+  i2s.setBitsPerSample(16);
+  i2s.setBuffers(AUDIO_NUM_BUFFERS, AUDIO_BLOCK_FRAMES, 0);
+
+  audio_evt_t e = { AUDIO_EVT_STARTED, 0, 0, 0 };
+  if (!i2s.begin(SAMPLE_RATE_HZ)) 
+  {
+    e.evt = AUDIO_EVT_FAILED;
+    audio_evt_q.push(e);
+    while (1); // do nothing
+  }
+  audio_evt_q.push(e);
+#if AUDIO_BENCH_AT_BOOT
+  for(int i=0;i<3;i++)
+    audio_evt_q.push(bench_evts[i]);
+#endif
+}
+
+// Sample rate switch in progress on this core: the rate to switch to, how
+// many silent blocks have gone out since the mute, and whether core 0 is
+// still to hear that the switch is done.
+static uint32_t rate_next = 0;
+static uint8_t rate_drained = 0;
+static bool rate_done_due = false;
+
+void audio_do_commands(void)
+{
+  audio_cmd_t c;
+  while(audio_cmd_q.pop(c))
+  {
+    switch(c.cmd)
+    {
+    case AUDIO_CMD_RENDERER:
+      if(c.a == AUDIO_SRC_SAMPLER)
+        audio_set_renderer(sampler_render, NULL);
+      else
+        audio_set_renderer(c.a == AUDIO_SRC_NOISE ? audio_render_noise : audio_render_silence, NULL);
+      break;
+    case AUDIO_CMD_NOTE_ON:
+      sampler_note_on(sampler_test_sample(), c.a, c.b ? c.b : 1, c.c);
+      break;
+    case AUDIO_CMD_NOTE_OFF:
+      sampler_note_off(c.a);
+      break;
+    case AUDIO_CMD_RATE:
+      rate_next = c.c;
+      rate_drained = 0;
+      audio_mute();
+      break;
+    case AUDIO_CMD_RESUME:
+      audio_unmute();
+      rate_done_due = true;
+      break;
+    }
+  }
+}
+
+// Once the mute has been rendered, the I2S buffers are played out with
+// silence: when AUDIO_NUM_BUFFERS more blocks have been written, the last
+// sound has left them. Then I2S is retimed and core 0 is told to do the
+// codec.
+void audio_rate_step(void)
+{
+  if(rate_done_due)
+  {
+    audio_evt_t e = { AUDIO_EVT_RATE, 0, 0, audio_sample_rate() };
+    rate_done_due = !audio_evt_q.push(e);
+  }
+  if(!rate_next || !audio_is_muted())
+    return;
+  if(rate_drained < AUDIO_NUM_BUFFERS)
+  {
+    rate_drained++;
+    return;
+  }
+  static uint32_t fades = 0;
+  audio_evt_t e = { AUDIO_EVT_PAUSED, (uint8_t)(audio_mute_fades() != fades), 0, rate_next };
+  if(!audio_evt_q.push(e))
+    return;   // try again after the next block
+  fades = audio_mute_fades();
+  i2s.setFrequency(rate_next);
+  audio_set_sample_rate(rate_next);
+  rate_next = 0;
+}
+
+void loop1()
+{
+  static uint8_t underruns = 0;
+  static uint16_t worst_us = 0;
+  static uint16_t nblocks = 0;
+
+  audio_do_commands();
+
+  uint32_t t0 = micros();
+  int16_t *blk = audio_render_block();
+  uint32_t us = micros() - t0;
+  if(us > worst_us)
+    worst_us = us > 0xFFFF ? 0xFFFF : us;
+  if(i2s.getUnderflow() && underruns < 255)
+    underruns++;
+  i2s_write_block(blk);
+  audio_rate_step();
+
+  // report now and then; if core 0 is behind, the report just waits
+  if(++nblocks >= AUDIO_STATS_BLOCKS)
+  {
+    audio_evt_t e = { AUDIO_EVT_STATS, underruns, worst_us, audio_blocks_rendered() };
+    if(audio_evt_q.push(e))
+    {
+      underruns = 0;
+      worst_us = 0;
+      nblocks = 0;
+    }
+  }
+}
+
 
 /*
    The MIT License (MIT)
@@ -0,0 +1,602 @@
+#include <string.h>
+#include <math.h>
+#include "sampler.h"
+#include "audio_engine.h"
+#if SAMPLER_HW_INTERP
+#include "hardware/interp.h"
+#endif
+
+// The mix is scaled down by this many bits on the way out, so a few
+// full-velocity voices can sound together before the output saturates.
+#define MIX_HEADROOM_BITS 2
+// ADPCM frames decoded past the one a voice needs, on each trip out of its
+// render loop to decode more, and the frames each voice keeps decoded
+#define DECODE_AHEAD 8
+#define DECODE_WINDOW 32
+static_assert(DECODE_WINDOW >= DECODE_AHEAD + 2, "DECODE_WINDOW too small");
+
+sampler_stats_t sampler_stats;
+
+static sampler_voice_t voices[SAMPLER_MAX_VOICES];
+static uint8_t n_voices = 0;
+static uint8_t interp_mode = SAMPLER_LINEAR;
+static uint32_t next_age = 0;
+static int32_t mix[AUDIO_BLOCK_SAMPLES];
+static int16_t caches[SAMPLER_MAX_VOICES][DECODE_WINDOW];
+
+// 2^(k/12) in Q16, for the semitones of an octave
+static const uint32_t semitone_q16[12] =
+{
+  65536, 69433, 73562, 77936, 82570, 87480, 92682, 98193, 104032, 110218, 116772, 123715
+};
+
+void sampler_init(uint8_t nv, uint8_t interp)
+{
+  memset(voices, 0, sizeof(voices));
+  memset(&sampler_stats, 0, sizeof(sampler_stats));
+  n_voices = nv > SAMPLER_MAX_VOICES ? SAMPLER_MAX_VOICES : nv;
+  interp_mode = interp;
+  next_age = 0;
+}
+
+void sampler_set_interp(uint8_t interp)
+{
+  interp_mode = interp;
+}
+
+// Phase step that plays 'smp' at 'note' on an output running at
+// out_rate_hz. Note-on only, so the 64-bit arithmetic doesn't matter.
+uint32_t sampler_pitch_step(const sample_t *smp, uint8_t note, uint32_t out_rate_hz)
+{
+  int32_t semis = (int32_t)note - smp->root_note;
+  int32_t oct = semis >= 0 ? semis / 12 : -((11 - semis) / 12);
+  semis -= oct * 12;
+  uint64_t step = ((uint64_t)smp->rate_hz << SAMPLER_FRAC_BITS) * semitone_q16[semis] / out_rate_hz;
+  step = oct >= 0 ? step << oct : step >> -oct;
+  step >>= 16;
+  // past 64x the output rate, a voice would skip most of its sample anyway
+  uint64_t max_step = (uint64_t)64 << SAMPLER_FRAC_BITS;
+  return step > max_step ? (uint32_t)max_step : step ? (uint32_t)step : 1;
+}
+
+static sampler_voice_t *pick_voice(void)
+{
+  sampler_voice_t *best = NULL;
+  for(uint8_t i=0;i<n_voices;i++)
+  {
+    if(!voices[i].active)
+      return &voices[i];
+  }
+  sampler_stats.steals++;
+  for(uint8_t i=0;i<n_voices;i++)
+  {
+    sampler_voice_t *v = &voices[i];
+    if(v->releasing && (!best || v->gain_l + v->gain_r < best->gain_l + best->gain_r))
+      best = v;
+  }
+  if(best)
+    return best;
+  best = &voices[0];
+  for(uint8_t i=1;i<n_voices;i++)
+  {
+    if(voices[i].age - next_age < best->age - next_age)
+      best = &voices[i];
+  }
+  return best;
+}
+
+// Frame i of an ADPCM sample, decoded from the start of its block.
+static int32_t adpcm_frame(const sample_t *smp, uint32_t i)
+{
+  const uint8_t *blk = smp->adpcm + i / ADPCM_BLOCK_FRAMES * ADPCM_BLOCK_BYTES;
+  adpcm_state_t s;
+  int32_t x = adpcm_block_start(&s, blk);
+  uint32_t n = i % ADPCM_BLOCK_FRAMES;
+  for(uint32_t k=1;k<=n;k++)
+    x = adpcm_decode(&s, adpcm_nibble(blk, k));
+  sampler_stats.decoded += n;
+  return x;
+}
+
+// Sets a voice going on a note, from silence.
+static void start_voice(sampler_voice_t *v, const sample_t *smp, uint8_t note, uint8_t velocity, uint8_t pan)
+{
+  bool looped = smp->loop_end && smp->loop_end <= smp->frames && smp->loop_end >= smp->loop_start + 4;
+  uint32_t limit = looped ? smp->loop_end : smp->frames;
+
+  v->smp = smp;
+  v->phase = 0;
+  v->step = sampler_pitch_step(smp, note, audio_sample_rate());
+  v->end_phase = (looped ? limit : limit - 1) << SAMPLER_FRAC_BITS;
+  v->loop_phase = looped ? (smp->loop_end - smp->loop_start) << SAMPLER_FRAC_BITS : 0;
+  v->fast_n = limit - 3;
+  if(smp->adpcm)
+  {
+    v->cache_first = 0;
+    v->cache_blk = smp->adpcm;
+    caches[v - voices][0] = adpcm_block_start(&v->dec, smp->adpcm);
+    v->cache_n = 1;
+    v->loop_first = looped ? adpcm_frame(smp, smp->loop_start) : 0;
+  }
+
+  int32_t g = velocity * velocity * 2;
+  v->gain_l = 0;
+  v->gain_r = 0;
+  v->target_l = g * (127 - pan < 64 ? 127 - pan : 64) / 64;
+  v->target_r = g * (pan < 64 ? pan : 64) / 64;
+  v->note = note;
+  v->releasing = 0;
+  v->active = 1;
+  v->next_smp = NULL;
+}
+
+// velocity 1..127, pan 0 (left) .. 64 (centre) .. 127 (right). Returns the
+// voice used, or -1 for a sample that can't be played. A voice taken while
+// it is still sounding ramps down over the next block first, like a
+// note-off, and the new note starts on the block after.
+int sampler_note_on(const sample_t *smp, uint8_t note, uint8_t velocity, uint8_t pan)
+{
+  if(!n_voices || !smp || (!smp->data && !smp->adpcm) || smp->frames < 4 || smp->frames > SAMPLER_MAX_FRAMES)
+    return -1;
+  if(velocity > 127)
+    velocity = 127;
+  if(pan > 127)
+    pan = 127;
+
+  sampler_voice_t *v = pick_voice();
+  if(v->active && (v->gain_l || v->gain_r))
+  {
+    v->target_l = 0;
+    v->target_r = 0;
+    v->releasing = 1;
+    v->next_smp = smp;
+    v->next_note = note;
+    v->next_velocity = velocity;
+    v->next_pan = pan;
+  } else
+    start_voice(v, smp, note, velocity, pan);
+  v->age = next_age++;
+
+  sampler_stats.notes++;
+  uint8_t n = sampler_active_voices();
+  if(n > sampler_stats.peak_voices)
+    sampler_stats.peak_voices = n;
+  return v - voices;
+}
+
+void sampler_note_off(uint8_t note)
+{
+  for(uint8_t i=0;i<n_voices;i++)
+  {
+    sampler_voice_t *v = &voices[i];
+    if(v->active && !v->releasing && v->note == note)
+    {
+      v->target_l = 0;
+      v->target_r = 0;
+      v->releasing = 1;
+    }
+    if(v->next_smp && v->next_note == note) // let go before it started
+      v->next_smp = NULL;
+  }
+}
+
+void sampler_all_off(void)
+{
+  for(uint8_t i=0;i<n_voices;i++)
+  {
+    voices[i].target_l = 0;
+    voices[i].target_r = 0;
+    voices[i].releasing = 1;
+    voices[i].next_smp = NULL;
+  }
+}
+
+uint8_t sampler_active_voices(void)
+{
+  uint8_t n = 0;
+  for(uint8_t i=0;i<n_voices;i++)
+    n += voices[i].active;
+  return n;
+}
+
+// A frame of the sample, for the edges the render loops don't take
+// unchecked: wrapped around the loop, silent past the end of a one-shot,
+// and before the start, held at the first frame or, for a loop from frame
+// 0, wrapped back to its end.
+static inline int32_t fetch(const sampler_voice_t *v, int32_t i)
+{
+  if(v->loop_phase)
+  {
+    int32_t len = v->loop_phase >> SAMPLER_FRAC_BITS;
+    if(i >= (int32_t)(v->end_phase >> SAMPLER_FRAC_BITS))
+      i -= len;
+    else if(i < 0)
+      i = v->smp->loop_start ? 0 : i + len;
+  } else if(i >= (int32_t)v->smp->frames)
+    return 0;
+  else if(i < 0)
+    i = 0;
+  return v->smp->data[i];
+}
+
+// Adds one voice into the mix. The interpolation is a template parameter so
+// each loop is compiled without a per-frame test for it.
+template <int INTERP>
+static void render_voice(sampler_voice_t *v, int32_t *m, uint32_t frames)
+{
+  const int16_t *d = v->smp->data;
+  uint32_t phase = v->phase;
+  const uint32_t step = v->step;
+  const uint32_t end = v->end_phase;
+  const uint32_t fast_n = v->fast_n;
+  // gains in Q30, so the per-frame ramp keeps its fraction
+  int32_t gl = v->gain_l << 15, gr = v->gain_r << 15;
+  const int32_t dgl = ((v->target_l - v->gain_l) << 15) / (int32_t)frames;
+  const int32_t dgr = ((v->target_r - v->gain_r) << 15) / (int32_t)frames;
+
+  for(uint32_t i=0;i<frames;i++)
+  {
+    uint32_t idx = phase >> SAMPLER_FRAC_BITS;
+    int32_t s;
+    if(INTERP == SAMPLER_LINEAR)
+    {
+      int32_t s0, s1;
+      if(idx - 1 < fast_n)
+      {
+        s0 = d[idx];
+        s1 = d[idx + 1];
+      } else
+      {
+        s0 = fetch(v, idx);
+        s1 = fetch(v, idx + 1);
+      }
+      s = s0 + (((s1 - s0) * (int32_t)(phase & SAMPLER_FRAC_MASK)) >> SAMPLER_FRAC_BITS);
+    } else
+    {
+      int32_t sm1, s0, s1, s2;
+      if(idx - 1 < fast_n)
+      {
+        sm1 = d[idx - 1];
+        s0 = d[idx];
+        s1 = d[idx + 1];
+        s2 = d[idx + 2];
+      } else
+      {
+        sm1 = fetch(v, (int32_t)idx - 1);
+        s0 = fetch(v, idx);
+        s1 = fetch(v, idx + 1);
+        s2 = fetch(v, idx + 2);
+      }
+      // Catmull-Rom with every coefficient doubled, and t in Q11 so no
+      // product passes 31 bits
+      int32_t t = (phase & SAMPLER_FRAC_MASK) >> (SAMPLER_FRAC_BITS - 11);
+      int32_t a = 3 * (s0 - s1) + s2 - sm1;
+      int32_t b = 2 * sm1 - 5 * s0 + 4 * s1 - s2;
+      int32_t c = s1 - sm1;
+      int32_t y = ((((a * t) >> 11) + b) * t) >> 11;
+      s = s0 + (((y + c) * t) >> 12);
+      if(s > 32767)
+        s = 32767;
+      else if(s < -32768)
+        s = -32768;
+    }
+    m[i * 2] += (s * (gl >> 15)) >> 15;
+    m[i * 2 + 1] += (s * (gr >> 15)) >> 15;
+    gl += dgl;
+    gr += dgr;
+    phase += step;
+    if(phase >= end)
+    {
+      if(!v->loop_phase)
+      {
+        v->active = 0;
+        sampler_stats.ended++;
+        break;
+      }
+      do
+        phase -= v->loop_phase;
+      while(phase >= end);
+    }
+  }
+  v->phase = phase;
+  v->gain_l = v->target_l;
+  v->gain_r = v->target_r;
+  if(v->releasing && !v->gain_l && !v->gain_r)
+    v->active = 0;
+}
+
+// Frame i of an ADPCM voice's sample, for whatever its render loop can't
+// take from the cache. Past the loop end is the loop's first frame, past the
+// end of a one-shot is silence, and just past the block being decoded is the
+// next block's first frame. Anything else decodes on in that block, or
+// starts on the block that holds it. The window moves up to start just
+// before i when the frames ahead wouldn't fit; the frames it skips over are
+// decoded, since the decoder only goes forward, but not kept.
+static int32_t adpcm_fetch(sampler_voice_t *v, int16_t *cache, uint32_t i)
+{
+  const sample_t *smp = v->smp;
+  uint32_t limit = v->loop_phase ? v->end_phase >> SAMPLER_FRAC_BITS : smp->frames;
+  if(i >= limit)
+    return v->loop_phase ? v->loop_first : 0;
+  uint32_t k = i - v->cache_first;
+  if(k < v->cache_n)
+    return cache[k];
+  uint32_t blk_first = (v->cache_blk - smp->adpcm) / ADPCM_BLOCK_BYTES * ADPCM_BLOCK_FRAMES;
+  if(i == blk_first + ADPCM_BLOCK_FRAMES)
+    return adpcm_block_first(v->cache_blk + ADPCM_BLOCK_BYTES);
+  if(i < v->cache_first || i > blk_first + ADPCM_BLOCK_FRAMES)
+  {
+    uint32_t b = i / ADPCM_BLOCK_FRAMES;
+    blk_first = b * ADPCM_BLOCK_FRAMES;
+    v->cache_first = blk_first;
+    v->cache_blk = smp->adpcm + b * ADPCM_BLOCK_BYTES;
+    cache[0] = adpcm_block_start(&v->dec, v->cache_blk);
+    v->cache_n = 1;
+    if(i == blk_first)
+      return cache[0];
+  }
+  // never past the limit, so the render loop comes here for the wrap
+  uint32_t to = i + DECODE_AHEAD;
+  if(to > blk_first + ADPCM_BLOCK_FRAMES - 1)
+    to = blk_first + ADPCM_BLOCK_FRAMES - 1;
+  if(to > limit - 1)
+    to = limit - 1;
+  // i is past everything decoded so far, so only the frame before it is kept:
+  // the render loop reads it again with i once the window has moved
+  uint32_t next = v->cache_first + v->cache_n;
+  if(to - v->cache_first >= DECODE_WINDOW)
+  {
+    if(i > v->cache_first && i - 1 < next)
+    {
+      cache[0] = cache[i - 1 - v->cache_first];
+      v->cache_first = i - 1;
+    }
+    else
+      v->cache_first = i;
+  }
+  sampler_stats.decoded += to + 1 - next;
+  for(;next<=to;next++)
+  {
+    int32_t x = adpcm_decode(&v->dec, adpcm_nibble(v->cache_blk, next - blk_first));
+    if(next >= v->cache_first)
+      cache[next - v->cache_first] = x;
+  }
+  v->cache_n = to + 1 - v->cache_first;
+  return cache[i - v->cache_first];
+}
+
+// An ADPCM voice, interpolated linearly. Frames come from the cache while
+// both are in it, which is nearly always.
+static void render_voice_adpcm(sampler_voice_t *v, int32_t *m, uint32_t frames)
+{
+  int16_t *cache = caches[v - voices];
+  uint32_t phase = v->phase;
+  const uint32_t step = v->step;
+  const uint32_t end = v->end_phase;
+  int32_t gl = v->gain_l << 15, gr = v->gain_r << 15;
+  const int32_t dgl = ((v->target_l - v->gain_l) << 15) / (int32_t)frames;
+  const int32_t dgr = ((v->target_r - v->gain_r) << 15) / (int32_t)frames;
+
+  for(uint32_t i=0;i<frames;i++)
+  {
+    uint32_t idx = phase >> SAMPLER_FRAC_BITS;
+    uint32_t k = idx - v->cache_first;
+    int32_t s0, s1;
+    if(k < v->cache_n - 1)   // k wraps round when idx is before the window
+    {
+      s0 = cache[k];
+      s1 = cache[k + 1];
+    } else
+    {
+      s0 = adpcm_fetch(v, cache, idx);
+      s1 = adpcm_fetch(v, cache, idx + 1);
+    }
+    int32_t s = s0 + (((s1 - s0) * (int32_t)(phase & SAMPLER_FRAC_MASK)) >> SAMPLER_FRAC_BITS);
+    m[i * 2] += (s * (gl >> 15)) >> 15;
+    m[i * 2 + 1] += (s * (gr >> 15)) >> 15;
+    gl += dgl;
+    gr += dgr;
+    phase += step;
+    if(phase >= end)
+    {
+      if(!v->loop_phase)
+      {
+        v->active = 0;
+        sampler_stats.ended++;
+        break;
+      }
+      do
+        phase -= v->loop_phase;
+      while(phase >= end);
+    }
+  }
+  v->phase = phase;
+  v->gain_l = v->target_l;
+  v->gain_r = v->target_r;
+  if(v->releasing && !v->gain_l && !v->gain_r)
+    v->active = 0;
+}
+
+// Linear interpolation between two frames with an 8-bit weight from the
+// top of the phase fraction, as INTERP0's blend mode does it.
+static inline int32_t blend8(int32_t s0, int32_t s1, uint32_t phase)
+{
+  int32_t alpha = (phase >> (SAMPLER_FRAC_BITS - 8)) & 0xFF;
+  return s0 + (((s1 - s0) * alpha) >> 8);
+}
+
+#if SAMPLER_HW_INTERP
+// INTERP1 lane 0 adds BASE0, the phase step, to ACCUM0 on every pop. Lane 1
+// reads the same accumulator and gives BASE1 + (phase >> FRAC_BITS) * 2,
+// the address of the frame, so one POP_LANE1 read is the address and the
+// step. INTERP0 lane 0 blends BASE0 and BASE1 by the 8 bits lane 1 takes
+// from the phase in ACCUM1.
+static void interp_setup(void)
+{
+  interp_config c = interp_default_config();
+  interp_config_set_add_raw(&c, true);
+  interp_set_config(interp1, 0, &c);
+  c = interp_default_config();
+  interp_config_set_cross_input(&c, true);
+  interp_config_set_shift(&c, SAMPLER_FRAC_BITS - 1);
+  interp_config_set_mask(&c, 1, 32 - SAMPLER_FRAC_BITS);
+  interp_set_config(interp1, 1, &c);
+
+  c = interp_default_config();
+  interp_config_set_blend(&c, true);
+  interp_config_set_signed(&c, true);
+  interp_set_config(interp0, 0, &c);
+  c = interp_default_config();
+  interp_config_set_shift(&c, SAMPLER_FRAC_BITS - 8);
+  interp_config_set_mask(&c, 0, 7);
+  interp_set_config(interp0, 1, &c);
+}
+#endif
+
+// SAMPLER_INTERP. Runs of frames that can't reach an edge of the sample go
+// through the interpolators without any checks; frames at an edge are
+// done one at a time in software through fetch(), with the same weight.
+static void render_voice_interp(sampler_voice_t *v, int32_t *m, uint32_t frames)
+{
+  const int16_t *d = v->smp->data;
+  uint32_t phase = v->phase;
+  const uint32_t step = v->step;
+  const uint32_t end = v->end_phase;
+  // frames 1..fast_n, as in render_voice()
+  const uint32_t fast_lo = 1u << SAMPLER_FRAC_BITS;
+  const uint32_t fast_hi = (v->fast_n + 1) << SAMPLER_FRAC_BITS;
+  int32_t gl = v->gain_l << 15, gr = v->gain_r << 15;
+  const int32_t dgl = ((v->target_l - v->gain_l) << 15) / (int32_t)frames;
+  const int32_t dgr = ((v->target_r - v->gain_r) << 15) / (int32_t)frames;
+
+  uint32_t i = 0;
+  while(i < frames)
+  {
+    if(phase >= fast_lo && phase < fast_hi)
+    {
+      uint32_t n = (fast_hi - phase + step - 1) / step;
+      if(n > frames - i)
+        n = frames - i;
+      int32_t *mi = m + i * 2;
+      i += n;
+#if SAMPLER_HW_INTERP
+      interp1->accum[0] = phase;
+      interp1->base[0] = step;
+      interp1->base[1] = (uintptr_t)d;
+      while(n--)
+      {
+        interp0->accum[1] = interp1->accum[0];
+        const int16_t *p = (const int16_t *)interp1->pop[1];
+        interp0->base[0] = p[0];
+        interp0->base[1] = p[1];
+        int32_t s = (int32_t)interp0->peek[0];
+        mi[0] += (s * (gl >> 15)) >> 15;
+        mi[1] += (s * (gr >> 15)) >> 15;
+        mi += 2;
+        gl += dgl;
+        gr += dgr;
+      }
+      phase = interp1->accum[0];
+#else
+      while(n--)
+      {
+        const int16_t *p = d + (phase >> SAMPLER_FRAC_BITS);
+        int32_t s = blend8(p[0], p[1], phase);
+        phase += step;
+        mi[0] += (s * (gl >> 15)) >> 15;
+        mi[1] += (s * (gr >> 15)) >> 15;
+        mi += 2;
+        gl += dgl;
+        gr += dgr;
+      }
+#endif
+    } else
+    {
+      uint32_t idx = phase >> SAMPLER_FRAC_BITS;
+      int32_t s = blend8(fetch(v, idx), fetch(v, idx + 1), phase);
+      m[i * 2] += (s * (gl >> 15)) >> 15;
+      m[i * 2 + 1] += (s * (gr >> 15)) >> 15;
+      gl += dgl;
+      gr += dgr;
+      phase += step;
+      i++;
+    }
+    if(phase >= end)
+    {
+      if(!v->loop_phase)
+      {
+        v->active = 0;
+        sampler_stats.ended++;
+        break;
+      }
+      do
+        phase -= v->loop_phase;
+      while(phase >= end);
+    }
+  }
+  v->phase = phase;
+  v->gain_l = v->target_l;
+  v->gain_r = v->target_r;
+  if(v->releasing && !v->gain_l && !v->gain_r)
+    v->active = 0;
+}
+
+void sampler_render(int16_t *out, uint32_t frames, void *ctx)
+{
+  (void)ctx;
+  memset(mix, 0, frames * AUDIO_CHANNELS * sizeof(int32_t));
+#if SAMPLER_HW_INTERP
+  if(interp_mode == SAMPLER_INTERP)
+    interp_setup();
+#endif
+  for(uint8_t i=0;i<n_voices;i++)
+  {
+    sampler_voice_t *v = &voices[i];
+    if(!v->active)
+      continue;
+    if(v->smp->adpcm)
+      render_voice_adpcm(v, mix, frames);
+    else if(interp_mode == SAMPLER_CUBIC)
+      render_voice<SAMPLER_CUBIC>(v, mix, frames);
+    else if(interp_mode == SAMPLER_INTERP)
+      render_voice_interp(v, mix, frames);
+    else
+      render_voice<SAMPLER_LINEAR>(v, mix, frames);
+    // a stolen voice has faded out: on to the note that took it
+    if(!v->active && v->next_smp)
+      start_voice(v, v->next_smp, v->next_note, v->next_velocity, v->next_pan);
+  }
+  for(uint32_t i=0;i<frames * AUDIO_CHANNELS;i++)
+  {
+    int32_t s = mix[i] >> MIX_HEADROOM_BITS;
+    out[i] = s > 32767 ? 32767 : s < -32768 ? -32768 : s;
+  }
+}
+
+// One cycle of a sawtooth made of its first 16 harmonics, 256 frames long.
+// Recorded at 256 x 440 Hz, so it plays A4 at its root note.
+#define TEST_FRAMES 256
+
+const sample_t *sampler_test_sample(void)
+{
+  static int16_t data[TEST_FRAMES];
+  static sample_t smp = { data, TEST_FRAMES, 0, TEST_FRAMES, TEST_FRAMES * 440, 69, NULL };
+  static bool built = false;
+  if(built)
+    return &smp;
+  float wave[TEST_FRAMES];
+  float peak = 0;
+  for(int i=0;i<TEST_FRAMES;i++)
+  {
+    float x = 0;
+    for(int k=1;k<=16;k++)
+      x += sinf(2 * (float)M_PI * k * i / TEST_FRAMES) / k;
+    wave[i] = x;
+    if(fabsf(x) > peak)
+      peak = fabsf(x);
+  }
+  for(int i=0;i<TEST_FRAMES;i++)
+    data[i] = (int16_t)(wave[i] * 30000 / peak);
+  built = true;
+  return &smp;
+}
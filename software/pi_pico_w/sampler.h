@@ -0,0 +1,122 @@
+#ifndef __SAMPLER_H__
+#define __SAMPLER_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include "adpcm.h"
+
+// Polyphonic sample playback, all in fixed point since the RP2040 has no
+// FPU.
+//
+// A sample is mono 16-bit PCM with an optional loop. Each voice steps
+// through its sample with a 32-bit phase, SAMPLER_FRAC_BITS of it fraction,
+// so any pitch ratio plays and a sample can be up to SAMPLER_MAX_FRAMES
+// long. Between frames it interpolates linearly, or with a 4-point cubic
+// (Catmull-Rom) for a cleaner top end at about twice the cost.
+//
+// Voices are summed into a 32-bit stereo mix, each through its own left and
+// right gains, and the mix is saturated into the interleaved I2S block.
+// Gain changes, note-off included, ramp linearly over one block so they
+// never click, and a released voice is freed when its ramp reaches zero.
+// If a note comes in with every voice busy, the quietest releasing voice is
+// taken, or failing that the oldest. A voice taken while it still sounds
+// ramps to zero over one block, and the new note starts on the next.
+//
+// SAMPLER_INTERP is linear interpolation on the RP2040's SIO interpolators:
+// INTERP1 steps the phase and turns it into a frame address, and INTERP0
+// blends the two frames, with an 8-bit weight. On other builds the same
+// loop runs in plain C++. Each core has its own interpolators, and on the
+// audio core only the sampler uses them.
+//
+// A sample can also be IMA-ADPCM (see adpcm.h), at a quarter of the size.
+// Each voice keeps a window of 32 decoded frames, 64 bytes, reaching a few
+// frames ahead of the play position. A voice decodes each frame it passes
+// once, and a jump (a loop, or a pitch far up) decodes at most one block
+// again, up to where it lands. The frame after a block is the next block's
+// first frame, which needs no decoding. ADPCM voices interpolate linearly,
+// whichever interpolation is set, since cubic would gain nothing over the
+// codec's own noise.
+//
+// sampler_render() is an audio_render_fn, and everything here runs on the
+// audio core. Pitches are worked out at note-on from audio_sample_rate().
+
+#define SAMPLER_FRAC_BITS   12
+#define SAMPLER_FRAC_MASK   ((1u << SAMPLER_FRAC_BITS) - 1)
+#define SAMPLER_MAX_FRAMES  (1u << (31 - SAMPLER_FRAC_BITS))
+#define SAMPLER_MAX_VOICES  32
+
+#if defined(ARDUINO_ARCH_RP2040)
+#define SAMPLER_HW_INTERP   1
+#else
+#define SAMPLER_HW_INTERP   0
+#endif
+
+typedef struct
+{
+  const int16_t *data;
+  uint32_t frames;
+  uint32_t loop_start;      // loops over loop_start..loop_end-1; no loop
+  uint32_t loop_end;        // if loop_end is 0
+  uint32_t rate_hz;         // rate it was recorded at
+  uint8_t  root_note;       // MIDI note it plays at unshifted
+  const uint8_t *adpcm;     // ADPCM blocks, in place of 'data'
+} sample_t;
+
+enum
+{
+  SAMPLER_LINEAR = 0,
+  SAMPLER_CUBIC,
+  SAMPLER_INTERP,
+};
+
+typedef struct
+{
+  const sample_t *smp;
+  uint32_t phase;           // frame << SAMPLER_FRAC_BITS | fraction
+  uint32_t step;            // phase advance per output frame
+  uint32_t end_phase;       // where it loops back or stops
+  uint32_t loop_phase;      // how far back a loop goes
+  uint32_t fast_n;          // frames 1..fast_n need no edge checks
+  int32_t  gain_l, gain_r;  // Q15, at the start of the next block
+  int32_t  target_l, target_r;
+  // ADPCM samples: a window of frames from cache_first on, in the block at
+  // cache_blk, and the decoder's state after the last of them
+  uint32_t cache_first;
+  uint32_t cache_n;
+  const uint8_t *cache_blk;
+  adpcm_state_t dec;
+  int32_t  loop_first;      // the frame at loop_start, for the wrap
+  uint32_t age;             // note-on order
+  // the note that stole this voice, to start once it has faded out
+  const sample_t *next_smp;
+  uint8_t  next_note, next_velocity, next_pan;
+  uint8_t  note;
+  uint8_t  active;
+  uint8_t  releasing;
+} sampler_voice_t;
+
+typedef struct
+{
+  uint32_t notes;           // notes started
+  uint32_t steals;          // notes that took a busy voice
+  uint32_t ended;           // one-shot voices that ran off the end
+  uint32_t decoded;         // ADPCM frames decoded
+  uint8_t  peak_voices;
+} sampler_stats_t;
+
+void     sampler_init(uint8_t voices, uint8_t interp);
+void     sampler_set_interp(uint8_t interp);
+int      sampler_note_on(const sample_t *smp, uint8_t note, uint8_t velocity, uint8_t pan);
+void     sampler_note_off(uint8_t note);
+void     sampler_all_off(void);
+uint8_t  sampler_active_voices(void);
+uint32_t sampler_pitch_step(const sample_t *smp, uint8_t note, uint32_t out_rate_hz);
+void     sampler_render(int16_t *out, uint32_t frames, void *ctx);
+
+// A looped single-cycle tone, built on first use, for trying out the keys
+// before there are real samples to load.
+const sample_t *sampler_test_sample(void);
+
+extern sampler_stats_t sampler_stats;
+
+#endif
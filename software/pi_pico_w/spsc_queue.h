@@ -0,0 +1,90 @@
+#ifndef __SPSC_QUEUE_H__
+#define __SPSC_QUEUE_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+// Bounded lock-free single-producer / single-consumer queue.
+//
+// One side only ever pushes and the other only ever pops, so head and tail
+// each have a single writer and plain atomic loads and stores are enough.
+// Nothing blocks, and a full queue makes push() fail instead of waiting.
+// That makes it safe between the two RP2040 cores and between an interrupt
+// handler and the main loop.
+//
+// N must be a power of two. Indices run freely and wrap at 2^32.
+template <typename T, uint32_t N>
+struct spsc_queue
+{
+  static_assert(N && !(N & (N - 1)), "spsc_queue size must be a power of two");
+
+  T items[N];
+  std::atomic<uint32_t> head{0};   // next slot to fill, written by producer
+  std::atomic<uint32_t> tail{0};   // next slot to drain, written by consumer
+
+  // producer side --------------------------------------------------------
+  bool push(const T &v)
+  {
+    T *slot = write_slot();
+    if(!slot)
+      return false;
+    *slot = v;
+    commit();
+    return true;
+  }
+
+  // Returns the slot to fill in place, or NULL if full. Nothing is visible
+  // to the consumer until commit().
+  T *write_slot(void)
+  {
+    uint32_t h = head.load(std::memory_order_relaxed);
+    if(h - tail.load(std::memory_order_acquire) >= N)
+      return NULL;
+    return &items[h & (N - 1)];
+  }
+
+  void commit(void)
+  {
+    head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  // consumer side --------------------------------------------------------
+  bool pop(T &v)
+  {
+    const T *slot = read_slot();
+    if(!slot)
+      return false;
+    v = *slot;
+    release();
+    return true;
+  }
+
+  // Returns the oldest item for reading in place, or NULL if empty. The
+  // slot stays owned by the consumer until release().
+  const T *read_slot(void)
+  {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    if(head.load(std::memory_order_acquire) == t)
+      return NULL;
+    return &items[t & (N - 1)];
+  }
+
+  void release(void)
+  {
+    tail.store(tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  // either side ----------------------------------------------------------
+  uint32_t size(void) const
+  {
+    return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+  }
+
+  uint32_t capacity(void) const
+  {
+    return N;
+  }
+};
+
+#endif
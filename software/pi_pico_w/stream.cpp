@@ -0,0 +1,252 @@
+#include <string.h>
+#include "stream.h"
+#include "audio_engine.h"
+
+stream_stats_t stream_stats;
+
+static stream_track_t tracks[STREAM_MAX_TRACKS];
+static const stream_dev_t *device = NULL;
+static int32_t mix[AUDIO_BLOCK_SAMPLES];
+// audio core: frames each track still has to skip, after running dry, to
+// get back in time
+static uint32_t skip[STREAM_MAX_TRACKS];
+
+void stream_init(const stream_dev_t *dev)
+{
+  device = dev;
+  for(int i=0;i<STREAM_MAX_TRACKS;i++)
+  {
+    // empty out the rings of tracks left open from before
+    while(tracks[i].ring.read_slot())
+      tracks[i].ring.release();
+    tracks[i].state = STREAM_IDLE;
+  }
+  memset(&stream_stats, 0, sizeof(stream_stats));
+  stream_stats.min_lead_us = UINT32_MAX;
+}
+
+// Returns the track, or -1 if they are all in use or the track doesn't
+// start on a chunk boundary.
+int stream_open(uint32_t first_block, uint32_t bytes, uint8_t channels, uint32_t rate_hz)
+{
+  if(channels < 1 || channels > 2 || !rate_hz || first_block % STREAM_CHUNK_BLOCKS)
+    return -1;
+  for(int i=0;i<STREAM_MAX_TRACKS;i++)
+  {
+    stream_track_t *t = &tracks[i];
+    if(t->state != STREAM_IDLE)
+      continue;
+    t->first_block = first_block;
+    t->frames = bytes / (channels * sizeof(int16_t));
+    t->rate_hz = rate_hz;
+    t->channels = channels;
+    t->gain = 0;
+    t->next_chunk = 0;
+    t->frames_loaded = 0;
+    t->frames_played = 0;
+    t->chunk_pos = 0;
+    skip[i] = 0;
+    t->state.store(STREAM_LOADING, std::memory_order_release);
+    return i;
+  }
+  return -1;
+}
+
+bool stream_ready(uint8_t track)
+{
+  stream_track_t *t = &tracks[track];
+  return t->state != STREAM_IDLE &&
+         (t->ring.size() == STREAM_RING_CHUNKS || t->frames_loaded == t->frames);
+}
+
+void stream_play(uint8_t track, int16_t gain)
+{
+  stream_track_t *t = &tracks[track];
+  if(t->state != STREAM_LOADING)
+    return;
+  t->gain = gain;
+  t->state.store(STREAM_PLAYING, std::memory_order_release);
+}
+
+void stream_stop(uint8_t track)
+{
+  stream_track_t *t = &tracks[track];
+  uint8_t s = STREAM_PLAYING;
+  if(!t->state.compare_exchange_strong(s, STREAM_STOPPING))
+  {
+    s = STREAM_LOADING;
+    t->state.compare_exchange_strong(s, STREAM_ENDED);
+  }
+}
+
+bool stream_done(uint8_t track)
+{
+  return tracks[track].state == STREAM_ENDED;
+}
+
+// Frees an ended track, or one that never started playing. The audio core
+// no longer looks at its ring, so the chunks left in it are released from
+// here.
+void stream_close(uint8_t track)
+{
+  stream_track_t *t = &tracks[track];
+  uint8_t s = t->state;
+  if(s != STREAM_ENDED && s != STREAM_LOADING)
+    return;
+  while(t->ring.read_slot())
+    t->ring.release();
+  t->state.store(STREAM_IDLE, std::memory_order_release);
+}
+
+// Reads the next chunk for the playing track that will run dry soonest,
+// unless a loading track wants one and no playing ring is short. Call it
+// whenever the UI core has nothing better to do; each call is one read.
+bool stream_service(void)
+{
+  stream_track_t *play = NULL, *load = NULL;
+  uint64_t play_buffered = 0, load_buffered = 0;
+  // fewest chunks queued on any playing track still to load, full or not
+  uint32_t play_chunks = STREAM_RING_CHUNKS;
+  for(int i=0;i<STREAM_MAX_TRACKS;i++)
+  {
+    stream_track_t *t = &tracks[i];
+    uint8_t s = t->state.load(std::memory_order_acquire);
+    if(s != STREAM_LOADING && s != STREAM_PLAYING)
+      continue;
+    uint32_t played = t->frames_played.load(std::memory_order_acquire);
+    uint32_t buffered = t->frames_loaded > played ? t->frames_loaded - played : 0;
+    if(s == STREAM_PLAYING && t->frames_loaded < t->frames)
+    {
+      uint32_t lead_us = (uint64_t)buffered * 1000000 / t->rate_hz;
+      if(lead_us < stream_stats.min_lead_us)
+        stream_stats.min_lead_us = lead_us;
+      if(t->ring.size() < play_chunks)
+        play_chunks = t->ring.size();
+    }
+    if(t->frames_loaded >= t->frames || t->ring.size() >= STREAM_RING_CHUNKS)
+      continue;
+    // earliest deadline: least buffered time, compared without dividing
+    stream_track_t **best = s == STREAM_PLAYING ? &play : &load;
+    uint64_t *best_buffered = s == STREAM_PLAYING ? &play_buffered : &load_buffered;
+    if(!*best || (uint64_t)buffered * (*best)->rate_hz < *best_buffered * t->rate_hz)
+    {
+      *best = t;
+      *best_buffered = buffered;
+    }
+  }
+  stream_track_t *best = play;
+  if(load && play_chunks >= STREAM_MIN_LEAD_CHUNKS)
+    best = load;
+  if(!best || !device)
+    return false;
+
+  stream_chunk_t *c = best->ring.write_slot();
+  uint32_t frame_bytes = best->channels * sizeof(int16_t);
+  uint32_t total_blocks = ((uint64_t)best->frames * frame_bytes + STREAM_BLOCK_BYTES - 1) / STREAM_BLOCK_BYTES;
+  uint32_t block = best->next_chunk * STREAM_CHUNK_BLOCKS;
+  uint32_t count = total_blocks - block < STREAM_CHUNK_BLOCKS ? total_blocks - block : STREAM_CHUNK_BLOCKS;
+  if(!device->read(device->ctx, best->first_block + block, count, c->data))
+  {
+    // play silence in its place rather than lose time
+    memset(c->data, 0, sizeof(c->data));
+    stream_stats.read_errors++;
+  }
+  stream_stats.reads++;
+  stream_stats.bytes += count * STREAM_BLOCK_BYTES;
+
+  uint32_t n = STREAM_CHUNK_BYTES / frame_bytes;
+  if(n > best->frames - best->frames_loaded)
+    n = best->frames - best->frames_loaded;
+  c->frames = n;
+  best->frames_loaded += n;
+  best->next_chunk++;
+  best->ring.commit();
+  return true;
+}
+
+// Mixes frames from one track's ring into the mix, skipping first whatever
+// it owes from running dry before. Returns the frames it had.
+static uint32_t take(stream_track_t *t, uint32_t *owed, int32_t *m, uint32_t frames)
+{
+  uint32_t done = 0;
+  const int32_t g = t->gain;
+  const stream_chunk_t *c;
+  while(done < frames && (c = t->ring.read_slot()))
+  {
+    uint32_t avail = c->frames - t->chunk_pos;
+    if(*owed)
+    {
+      uint32_t n = *owed < avail ? *owed : avail;
+      *owed -= n;
+      t->chunk_pos += n;
+    } else
+    {
+      uint32_t n = frames - done < avail ? frames - done : avail;
+      const int16_t *p = (const int16_t *)c->data + t->chunk_pos * t->channels;
+      int32_t *mp = m + done * 2;
+      if(t->channels == 2)
+      {
+        for(uint32_t i=0;i<n * 2;i++)
+          mp[i] += (p[i] * g) >> 15;
+      } else
+      {
+        for(uint32_t i=0;i<n;i++)
+        {
+          int32_t s = (p[i] * g) >> 15;
+          mp[i * 2] += s;
+          mp[i * 2 + 1] += s;
+        }
+      }
+      t->chunk_pos += n;
+      done += n;
+    }
+    if(t->chunk_pos == c->frames)
+    {
+      t->ring.release();
+      t->chunk_pos = 0;
+    }
+  }
+  return done;
+}
+
+void stream_render(int16_t *out, uint32_t frames, void *ctx)
+{
+  (void)ctx;
+  memset(mix, 0, frames * AUDIO_CHANNELS * sizeof(int32_t));
+  for(int i=0;i<STREAM_MAX_TRACKS;i++)
+  {
+    stream_track_t *t = &tracks[i];
+    uint8_t s = t->state.load(std::memory_order_acquire);
+    if(s == STREAM_STOPPING)
+    {
+      t->state.store(STREAM_ENDED, std::memory_order_release);
+      continue;
+    }
+    if(s != STREAM_PLAYING)
+      continue;
+
+    // the track's position moves on with the clock even when its ring is
+    // dry, so all the tracks stay in time
+    uint32_t pos = t->frames_played.load(std::memory_order_relaxed);
+    uint32_t want = t->frames - pos < frames ? t->frames - pos : frames;
+    uint32_t done = take(t, &skip[i], mix, want);
+    if(done < want)
+    {
+      stream_stats.underruns++;
+      stream_stats.underrun_frames += want - done;
+      skip[i] += want - done;
+    }
+    pos += want;
+    t->frames_played.store(pos, std::memory_order_release);
+    if(pos >= t->frames)
+    {
+      uint8_t p = STREAM_PLAYING;
+      t->state.compare_exchange_strong(p, STREAM_ENDED);
+    }
+  }
+  for(uint32_t i=0;i<frames * AUDIO_CHANNELS;i++)
+  {
+    int32_t v = mix[i];
+    out[i] = v > 32767 ? 32767 : v < -32768 ? -32768 : v;
+  }
+}
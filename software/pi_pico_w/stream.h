@@ -0,0 +1,122 @@
+#ifndef __STREAM_H__
+#define __STREAM_H__
+
+#include <stdint.h>
+#include <atomic>
+#include "spsc_queue.h"
+
+// Multi-track audio streaming from an SD card, or any block device.
+//
+// There isn't room in the Pico's 264 KB of RAM to load tracks whole. Each
+// open track gets a fixed ring of STREAM_RING_CHUNKS chunks, each
+// STREAM_CHUNK_BLOCKS blocks long. stream_service(), a background task on
+// the UI core, keeps the rings topped up with reads of a whole chunk. A
+// track has to start on a chunk boundary, so the reads are aligned to the
+// chunk size on the card, since that is what SD cards do fastest, and land
+// straight in the ring.
+//
+// Playing rings are refilled earliest deadline first. Each call reads one
+// chunk, for the playing track whose ring will run dry soonest going by
+// the frames it holds and its sample rate. Rings still loading for a track
+// yet to play only get a read while every playing ring holds at least
+// STREAM_MIN_LEAD_CHUNKS chunks, so starting a track can't starve the ones
+// already playing. A ring with no free chunk waits its turn.
+//
+// On the audio core, stream_render() is an audio_render_fn. It mixes every
+// playing track into the block, at the track's own gain. A track whose
+// ring runs dry plays silence for the gap and counts an underrun. The rings
+// are spsc_queues of chunks, so the two cores share nothing else but the
+// track state and a frame counter.
+//
+// A track is a contiguous run of blocks holding 16-bit PCM, mono or
+// interleaved stereo, that starts on a chunk boundary. Finding it in a file
+// system is up to the caller. Tracks play at their own rate, so their rate
+// should match the output's (see audio_change_rate()).
+//
+//   core 0: stream_open()     ring starts filling
+//           stream_ready()    ring full, or the whole track is in it
+//           stream_play()
+//   core 1:                   plays to the end, or until stream_stop()
+//   core 0: stream_done()     then stream_close() frees the track
+
+#ifndef STREAM_BLOCK_BYTES
+#define STREAM_BLOCK_BYTES    512
+#endif
+#ifndef STREAM_CHUNK_BLOCKS
+#define STREAM_CHUNK_BLOCKS   4
+#endif
+#ifndef STREAM_RING_CHUNKS
+#define STREAM_RING_CHUNKS    4     // a power of two
+#endif
+#ifndef STREAM_MIN_LEAD_CHUNKS
+#define STREAM_MIN_LEAD_CHUNKS (STREAM_RING_CHUNKS / 2)
+#endif
+#ifndef STREAM_MAX_TRACKS
+#define STREAM_MAX_TRACKS     8
+#endif
+#define STREAM_CHUNK_BYTES    (STREAM_CHUNK_BLOCKS * STREAM_BLOCK_BYTES)
+#define STREAM_RING_BYTES     (STREAM_RING_CHUNKS * STREAM_CHUNK_BYTES)
+
+// Reads 'count' blocks from 'block' on into 'dst', which is word aligned.
+// Returns false on an error.
+typedef struct
+{
+  bool (*read)(void *ctx, uint32_t block, uint32_t count, uint8_t *dst);
+  void *ctx;
+} stream_dev_t;
+
+enum
+{
+  STREAM_IDLE = 0,
+  STREAM_LOADING,           // opened, ring filling
+  STREAM_PLAYING,
+  STREAM_STOPPING,          // stop asked for, not yet seen by the audio core
+  STREAM_ENDED,             // played to the end, or stopped
+};
+
+typedef struct
+{
+  uint8_t  data[STREAM_CHUNK_BYTES] __attribute__((aligned(4)));
+  uint32_t frames;
+} stream_chunk_t;
+
+typedef struct
+{
+  std::atomic<uint8_t> state;
+  spsc_queue<stream_chunk_t, STREAM_RING_CHUNKS> ring;
+  uint32_t first_block;
+  uint32_t frames;          // in the whole track
+  uint32_t rate_hz;
+  uint8_t  channels;
+  int16_t  gain;            // Q15
+  // UI core
+  uint32_t next_chunk;      // chunks read so far
+  uint32_t frames_loaded;
+  // audio core
+  std::atomic<uint32_t> frames_played;
+  uint32_t chunk_pos;       // frames taken from the oldest chunk
+} stream_track_t;
+
+typedef struct
+{
+  uint32_t reads;           // chunk reads
+  uint32_t read_errors;
+  uint32_t bytes;
+  uint32_t underruns;       // blocks in which a playing track ran dry
+  uint32_t underrun_frames; // frames of silence they played
+  uint32_t min_lead_us;     // least time to empty a ring was seen with
+} stream_stats_t;
+
+void stream_init(const stream_dev_t *dev);
+int  stream_open(uint32_t first_block, uint32_t bytes, uint8_t channels, uint32_t rate_hz);
+bool stream_ready(uint8_t track);
+void stream_play(uint8_t track, int16_t gain);
+void stream_stop(uint8_t track);
+bool stream_done(uint8_t track);
+void stream_close(uint8_t track);
+bool stream_service(void);  // true if it read a chunk
+void stream_render(int16_t *out, uint32_t frames, void *ctx);
+
+extern stream_stats_t stream_stats;
+
+#endif
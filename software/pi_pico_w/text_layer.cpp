@@ -0,0 +1,160 @@
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "text_layer.h"
+
+typedef struct
+{
+  char     ch;
+  uint16_t fg;
+  uint16_t bg;
+} text_cell_t;
+
+static TFT_eSPI *disp = NULL;
+static int16_t org_x = 0, org_y = 0;
+static uint8_t n_cols = 0, n_rows = 0;              // cells that fit on the panel
+static text_cell_t want[TEXT_ROWS][TEXT_COLS];    // what should be shown
+static text_cell_t shown[TEXT_ROWS][TEXT_COLS];   // what is on the panel
+static uint64_t dirty[TEXT_ROWS];                 // one bit per column
+
+static const char hex_digits[] = "0123456789ABCDEF";
+
+text_stats_t text_stats;
+
+static_assert(TEXT_COLS <= 64, "dirty masks hold 64 columns");
+
+// Compositor overlay: every cell the background repaint touched has lost
+// its glyph, and opaque cells their fill too.
+static void text_overlay(const comp_rect_t *r)
+{
+  int c0 = (r->x - org_x) / TEXT_CELL_W;
+  int c1 = (r->x + r->w - 1 - org_x) / TEXT_CELL_W;
+  int r0 = (r->y - org_y) / TEXT_CELL_H;
+  int r1 = (r->y + r->h - 1 - org_y) / TEXT_CELL_H;
+  if(r->x + r->w <= org_x || r->y + r->h <= org_y)
+    return;
+  if(c0 < 0) c0 = 0;
+  if(r0 < 0) r0 = 0;
+  if(c1 >= n_cols) c1 = n_cols - 1;
+  if(r1 >= n_rows) r1 = n_rows - 1;
+  if(c0 > c1 || r0 > r1)
+    return;
+  uint64_t m = ((~0ull) >> (63 - (c1 - c0))) << c0;
+  for(int row=r0;row<=r1;row++)
+  {
+    for(int col=c0;col<=c1;col++)
+      shown[row][col].ch = 0;   // force a redraw, even of blanks
+    dirty[row] |= m;
+  }
+}
+
+// Cells start out as transparent blanks, i.e. showing just the background.
+// Only the whole cells between the origin and the panel's edges are used.
+void text_init(TFT_eSPI *tft, int16_t x0, int16_t y0)
+{
+  disp = tft;
+  org_x = x0;
+  org_y = y0;
+  int cols = x0 < 0 || x0 >= COMP_SCREEN_W ? 0 : (COMP_SCREEN_W - x0) / TEXT_CELL_W;
+  int rows = y0 < 0 || y0 >= COMP_SCREEN_H ? 0 : (COMP_SCREEN_H - y0) / TEXT_CELL_H;
+  n_cols = cols > TEXT_COLS ? TEXT_COLS : cols;
+  n_rows = rows > TEXT_ROWS ? TEXT_ROWS : rows;
+  for(int r=0;r<TEXT_ROWS;r++)
+  {
+    for(int c=0;c<TEXT_COLS;c++)
+    {
+      want[r][c].ch = ' ';
+      want[r][c].fg = want[r][c].bg = 0;
+    }
+    dirty[r] = 0;
+  }
+  memcpy(shown, want, sizeof(shown));
+  comp_set_overlay(text_overlay);
+}
+
+void text_put(uint8_t col, uint8_t row, char c, uint16_t fg, uint16_t bg)
+{
+  if(col >= n_cols || row >= n_rows)
+    return;
+  text_cell_t &w = want[row][col];
+  if(w.ch == c && w.fg == fg && w.bg == bg)
+  {
+    text_stats.cells_skipped++;
+    return;
+  }
+  w.ch = c;
+  w.fg = fg;
+  w.bg = bg;
+  const text_cell_t &s = shown[row][col];
+  if(s.ch == c && s.fg == fg && s.bg == bg)
+    dirty[row] &= ~(1ull << col);   // changed back before it was drawn
+  else
+    dirty[row] |= 1ull << col;
+}
+
+void text_print(uint8_t col, uint8_t row, const char *s, uint16_t fg, uint16_t bg)
+{
+  while(*s)
+    text_put(col++, row, *s++, fg, bg);
+}
+
+void text_hex8(uint8_t col, uint8_t row, uint8_t v, uint16_t fg, uint16_t bg)
+{
+  text_put(col,     row, hex_digits[v >> 4], fg, bg);
+  text_put(col + 1, row, hex_digits[v & 15], fg, bg);
+}
+
+void text_hex16(uint8_t col, uint8_t row, uint16_t v, uint16_t fg, uint16_t bg)
+{
+  text_hex8(col,     row, v >> 8, fg, bg);
+  text_hex8(col + 2, row, v & 0xFF, fg, bg);
+}
+
+void text_flush(void)
+{
+  // A transparent cell can't erase what was there before, so have the
+  // compositor repaint the background under it first. The overlay hook
+  // then marks those cells (and any neighbours the repaint covered).
+  // Opaque cells fill themselves and need no help.
+  for(uint8_t row=0;row<TEXT_ROWS;row++)
+  {
+    uint64_t m = dirty[row];
+    for(uint8_t col=0;m;col++, m>>=1)
+    {
+      if(!(m & 1))
+        continue;
+      const text_cell_t &s = shown[row][col];
+      const text_cell_t &w = want[row][col];
+      bool was_bare = s.ch == 0 || (s.fg == s.bg && s.ch == ' ');
+      if(w.fg == w.bg && !was_bare)
+        comp_damage(org_x + col * TEXT_CELL_W, org_y + row * TEXT_CELL_H, TEXT_CELL_W, TEXT_CELL_H);
+    }
+  }
+  comp_flush();
+
+  for(uint8_t row=0;row<TEXT_ROWS;row++)
+  {
+    uint64_t m = dirty[row];
+    for(uint8_t col=0;m;col++, m>>=1)
+    {
+      if(!(m & 1))
+        continue;
+      const text_cell_t &w = want[row][col];
+      // a transparent blank is just background, already in place
+      if(!(w.fg == w.bg && w.ch == ' '))
+        disp->drawChar(org_x + col * TEXT_CELL_W, org_y + row * TEXT_CELL_H, w.ch, w.fg, w.bg, TEXT_SIZE);
+      shown[row][col] = w;
+      text_stats.cells_drawn++;
+    }
+    dirty[row] = 0;
+  }
+}
+
+uint8_t text_cols(void)
+{
+  return n_cols;
+}
+
+uint8_t text_rows(void)
+{
+  return n_rows;
+}
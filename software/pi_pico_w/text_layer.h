@@ -0,0 +1,47 @@
+#ifndef __TEXT_LAYER_H__
+#define __TEXT_LAYER_H__
+
+#include <stdint.h>
+#include "compositor.h"
+
+class TFT_eSPI;
+
+// Character-cell text layer drawn over the compositor background.
+//
+// Callers write characters into cells, and text_flush() redraws only the
+// cells whose character or colors changed since they were last drawn. It
+// also redraws any cell the compositor has repainted underneath. Writing
+// the same thing again costs a compare and nothing else, so it is fine to
+// rewrite whole lines every pass.
+//
+// Colors follow TFT_eSPI: when bg == fg the cell is transparent, so the
+// background shows through around the glyph.
+//
+// TEXT_COLS x TEXT_ROWS is the grid for an origin of (0, 0). Further in,
+// text_init() keeps only the cells that fit on the panel, and writes to
+// the rest are ignored; text_rows() and text_cols() say how many that is.
+
+#define TEXT_SIZE     2                 // built-in font scale
+#define TEXT_CELL_W   (6 * TEXT_SIZE)
+#define TEXT_CELL_H   (8 * TEXT_SIZE)
+#define TEXT_COLS     (COMP_SCREEN_W / TEXT_CELL_W)
+#define TEXT_ROWS     (COMP_SCREEN_H / TEXT_CELL_H)
+
+typedef struct
+{
+  uint32_t cells_drawn;
+  uint32_t cells_skipped;   // writes that changed nothing
+} text_stats_t;
+
+void text_init(TFT_eSPI *tft, int16_t x0, int16_t y0);
+void text_put(uint8_t col, uint8_t row, char c, uint16_t fg, uint16_t bg);
+void text_print(uint8_t col, uint8_t row, const char *s, uint16_t fg, uint16_t bg);
+void text_hex8(uint8_t col, uint8_t row, uint8_t v, uint16_t fg, uint16_t bg);
+void text_hex16(uint8_t col, uint8_t row, uint16_t v, uint16_t fg, uint16_t bg);
+void text_flush(void);
+uint8_t text_cols(void);
+uint8_t text_rows(void);
+
+extern text_stats_t text_stats;
+
+#endif